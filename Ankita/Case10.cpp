@@ -1,26 +1,217 @@
 #include <bits/stdc++.h>
+#ifdef __SSE2__
+#include <immintrin.h>
+#endif
 using namespace std;
 
+/*************************************************************
+ * 0. COLUMNAR PRODUCT CATALOG
+ * Dictionary-encoded names, contiguous numeric columns
+ *************************************************************/
+class ProductCatalog {
+public:
+    vector<uint32_t> nameId;
+    vector<int> sales;
+
+    void reserve(size_t n, size_t nameBytes=0){
+        nameId.reserve(n); sales.reserve(n);
+        offsets.reserve(n+1); arena.reserve(nameBytes);
+    }
+
+    void add(string_view name, int s){
+        nameId.push_back(intern(name));
+        sales.push_back(s);
+    }
+
+    // For names known to be new (e.g. generated ids): skips the dictionary lookup;
+    // the hash index catches up on the next add()
+    void addNew(string_view name, int s){
+        nameId.push_back(newTerm(name));
+        sales.push_back(s);
+    }
+
+    size_t size() const { return sales.size(); }
+    string_view name(size_t i) const { return term(nameId[i]); }
+    size_t distinctNames() const { return offsets.size()-1; }
+    size_t bytes() const {
+        return arena.capacity()+(offsets.capacity()+slots.capacity()+nameId.capacity()+sales.capacity())*4;
+    }
+
+private:
+    string arena;
+    vector<uint32_t> offsets{0};
+    vector<uint32_t> slots;   // open addressing: name id+1, 0 = empty
+    size_t indexed=0;         // names [0, indexed) are in slots
+
+    string_view term(uint32_t id) const { return string_view(arena.data()+offsets[id],offsets[id+1]-offsets[id]); }
+
+    uint32_t newTerm(string_view w){
+        arena.append(w.data(),w.size());
+        offsets.push_back(arena.size());
+        return offsets.size()-2;
+    }
+
+    uint32_t intern(string_view w){
+        if(offsets.size()*2>slots.size() || indexed<distinctNames()) rebuildIndex();
+        size_t mask=slots.size()-1;
+        for(size_t h=hash<string_view>()(w)&mask;;h=(h+1)&mask){
+            if(!slots[h]){
+                slots[h]=newTerm(w)+1;
+                indexed++;
+                return slots[h]-1;
+            }
+            if(term(slots[h]-1)==w) return slots[h]-1;
+        }
+    }
+
+    void rebuildIndex(){
+        size_t cap=1024;
+        while(cap<offsets.size()*2) cap*=2;
+        slots.assign(cap,0);
+        for(uint32_t id=0;id<distinctNames();id++){
+            size_t h=hash<string_view>()(term(id))&(cap-1);
+            while(slots[h]) h=(h+1)&(cap-1);
+            slots[h]=id+1;
+        }
+        indexed=distinctNames();
+    }
+};
+
+struct SalesStats {
+    long long sum=0;
+    int minv=INT_MAX, maxv=INT_MIN;
+    size_t count=0;
+    double avg() const { return count? (double)sum/count : 0; }
+};
+
+#ifdef __SSE2__
+inline __m128i min32(__m128i a, __m128i b){
+#ifdef __SSE4_1__
+    return _mm_min_epi32(a,b);
+#else
+    __m128i m=_mm_cmplt_epi32(a,b);
+    return _mm_or_si128(_mm_and_si128(m,a),_mm_andnot_si128(m,b));
+#endif
+}
+inline __m128i max32(__m128i a, __m128i b){
+#ifdef __SSE4_1__
+    return _mm_max_epi32(a,b);
+#else
+    __m128i m=_mm_cmpgt_epi32(a,b);
+    return _mm_or_si128(_mm_and_si128(m,a),_mm_andnot_si128(m,b));
+#endif
+}
+#endif
+
+// Sum, min, max and count of a column in one pass, 8 values per step.
+// Values are sign-extended to 64-bit lanes for the sum, so it cannot overflow.
+SalesStats aggregateColumn(const int *v, size_t n){
+    SalesStats st;
+    st.count=n;
+    size_t i=0;
+#ifdef __SSE2__
+    __m128i lo=_mm_setzero_si128(), hi=_mm_setzero_si128();
+    __m128i mn=_mm_set1_epi32(INT_MAX), mx=_mm_set1_epi32(INT_MIN);
+    for(;i+8<=n;i+=8){
+        __m128i a=_mm_loadu_si128((const __m128i*)(v+i)), b=_mm_loadu_si128((const __m128i*)(v+i+4));
+        mn=min32(mn,min32(a,b));
+        mx=max32(mx,max32(a,b));
+        __m128i sa=_mm_srai_epi32(a,31), sb=_mm_srai_epi32(b,31);
+        lo=_mm_add_epi64(lo,_mm_add_epi64(_mm_unpacklo_epi32(a,sa),_mm_unpacklo_epi32(b,sb)));
+        hi=_mm_add_epi64(hi,_mm_add_epi64(_mm_unpackhi_epi32(a,sa),_mm_unpackhi_epi32(b,sb)));
+    }
+    alignas(16) long long s[2];
+    alignas(16) int m[4], M[4];
+    _mm_store_si128((__m128i*)s,_mm_add_epi64(lo,hi));
+    _mm_store_si128((__m128i*)m,mn);
+    _mm_store_si128((__m128i*)M,mx);
+    st.sum=s[0]+s[1];
+    for(int j=0;j<4;j++){ st.minv=min(st.minv,m[j]); st.maxv=max(st.maxv,M[j]); }
+#endif
+    for(;i<n;i++){
+        st.sum+=v[i];
+        st.minv=min(st.minv,v[i]); st.maxv=max(st.maxv,v[i]);
+    }
+    return st;
+}
+
 /*************************************************************
  * 1. HEAP / PRIORITY QUEUE: Top-k products by sales
  *************************************************************/
+// The k best indices of [lo,hi) under `better`, best first. The heap holds
+// k indices with the weakest on top, so most items cost one comparison.
+template<class Better> vector<int> streamTopK(int lo, int hi, int k, Better better){
+    vector<int> heap;
+    if(k<=0) return heap;
+    heap.reserve(k);
+    for(int i=lo;i<hi;i++){
+        if(heap.size()<(size_t)k){ heap.push_back(i); push_heap(heap.begin(),heap.end(),better); }
+        else if(better(i,heap[0])){
+            pop_heap(heap.begin(),heap.end(),better);
+            heap.back()=i;
+            push_heap(heap.begin(),heap.end(),better);
+        }
+    }
+    sort_heap(heap.begin(),heap.end(),better);
+    return heap;
+}
+
 class SalesAnalytics {
 public:
-    vector<string> products;
-    vector<int> sales;
+    ProductCatalog catalog;
+
+    SalesAnalytics(ProductCatalog c) : catalog(move(c)) {}
 
-    SalesAnalytics(vector<string> p, vector<int> s) : products(p), sales(s) {}
+    // Same order the (sales, name) max-heap popped in: higher sales, then larger name
+    bool better(int a, int b) const {
+        const vector<int> &sales=catalog.sales;
+        return sales[a]!=sales[b]? sales[a]>sales[b] : catalog.name(a)>catalog.name(b);
+    }
+
+    // Streaming: one pass with a k-entry heap of indices
+    vector<int> topKIndices(int k) const {
+        return streamTopK(0,catalog.size(),k,[this](int a,int b){ return better(a,b); });
+    }
+
+    // Batch: nth_element over all indices, then sort only the first k
+    vector<int> topKIndicesBatch(int k) const {
+        auto cmp=[this](int a,int b){ return better(a,b); };
+        vector<int> idx(catalog.size());
+        iota(idx.begin(),idx.end(),0);
+        k=max(0,min<int>(k,idx.size()));
+        nth_element(idx.begin(),idx.begin()+k,idx.end(),cmp);
+        idx.resize(k);
+        sort(idx.begin(),idx.end(),cmp);
+        return idx;
+    }
+
+    // Parallel: one streaming heap per slice, candidates merged at the end
+    vector<int> topKIndicesParallel(int k, int threads=0) const {
+        auto cmp=[this](int a,int b){ return better(a,b); };
+        int n=catalog.size();
+        if(threads<=0) threads=max(1u,thread::hardware_concurrency());
+        threads=max(1,min(threads,n/65536));
+        vector<vector<int>> part(threads);
+        vector<thread> pool;
+        for(int t=0;t<threads;t++)
+            pool.emplace_back([&,t](){ part[t]=streamTopK((long long)n*t/threads,(long long)n*(t+1)/threads,k,cmp); });
+        for(auto &th: pool) th.join();
+        vector<int> all;
+        for(auto &p: part) all.insert(all.end(),p.begin(),p.end());
+        int keep=max(0,min<int>(k,all.size()));
+        partial_sort(all.begin(),all.begin()+keep,all.end(),cmp);
+        all.resize(keep);
+        return all;
+    }
 
     vector<pair<int,string>> topK(int k) {
-        priority_queue<pair<int,string>> pq;
-        for(int i=0;i<products.size();i++) pq.push({sales[i],products[i]});
         vector<pair<int,string>> result;
-        for(int i=0;i<k && !pq.empty();i++){
-            result.push_back(pq.top()); pq.pop();
-        }
+        for(int i: topKIndices(k)) result.push_back({catalog.sales[i],string(catalog.name(i))});
         return result;
     }
 
+    SalesStats stats() const { return aggregateColumn(catalog.sales.data(),catalog.size()); }
+
     void printTopK(int k){
         vector<pair<int,string>> top=topK(k);
         cout<<"\nTop "<<k<<" Products by Sales:\n";
@@ -136,10 +327,24 @@ public:
  *************************************************************/
 vector<string> generateProducts(int n){
     vector<string> products;
+    products.reserve(n);
     for(int i=1;i<=n;i++) products.push_back("Product_"+to_string(i));
     return products;
 }
 
+// Names Product_1..n with the given sales, written straight into the columns
+ProductCatalog generateCatalog(const vector<int> &sales){
+    ProductCatalog catalog;
+    size_t n=sales.size();
+    catalog.reserve(n,n*17);
+    char buf[32]="Product_";
+    for(size_t i=0;i<n;i++){
+        char *end=to_chars(buf+8,buf+sizeof(buf),i+1).ptr;
+        catalog.addNew(string_view(buf,end-buf),sales[i]);
+    }
+    return catalog;
+}
+
 vector<int> generateSales(int n){
     vector<int> sales;
     srand(time(0));
@@ -154,18 +359,106 @@ vector<int> generateTasks(int n){
     return tasks;
 }
 
+/*************************************************************
+ * BENCHMARKS (run with: ./Case10 bench <name> [size])
+ *************************************************************/
+double secondsSince(chrono::steady_clock::time_point t0){
+    return chrono::duration<double>(chrono::steady_clock::now()-t0).count();
+}
+
+void benchTopK(size_t n){
+    const int k=100;
+    cout<<"\n--- Top-"<<k<<" sales benchmark ("<<n<<" products) ---\n";
+    mt19937 rng(7);
+    vector<int> sales(n);
+    for(auto &x: sales) x=rng()%100000000;
+    SalesAnalytics sa(generateCatalog(sales));
+    sales=vector<int>();
+    const vector<int> &col=sa.catalog.sales;
+    auto report=[&](const string &name, double sec, const vector<int> &top){
+        cout<<name<<": "<<sec*1e3<<" ms ("<<n/sec/1e6<<" M products/s), best "<<sa.catalog.name(top[0])
+            <<" with "<<col[top[0]]<<", k-th "<<col[top.back()]<<endl;
+    };
+    auto t0=chrono::steady_clock::now();
+    vector<int> stream=sa.topKIndices(k);
+    report("streaming k-heap",secondsSince(t0),stream);
+    t0=chrono::steady_clock::now();
+    vector<int> batch=sa.topKIndicesBatch(k);
+    report("nth_element batch",secondsSince(t0),batch);
+    int threads=max(1u,thread::hardware_concurrency());
+    t0=chrono::steady_clock::now();
+    vector<int> par=sa.topKIndicesParallel(k,threads);
+    report("parallel heaps ("+to_string(threads)+" threads)",secondsSince(t0),par);
+    if(stream!=batch || stream!=par) cout<<"MISMATCH between top-k modes"<<endl;
+
+    // The old path copies every name; run it on at most 10M products to stay in memory
+    size_t m=min<size_t>(n,10000000);
+    t0=chrono::steady_clock::now();
+    priority_queue<pair<int,string>> pq;
+    for(size_t i=0;i<m;i++) pq.push({col[i],string(sa.catalog.name(i))});
+    for(int i=0;i<k;i++) pq.pop();
+    double sec=secondsSince(t0);
+    cout<<"priority_queue<pair<int,string>> of "<<m<<" products: "<<sec*1e3<<" ms ("<<m/sec/1e6<<" M products/s)"<<endl;
+}
+
+void benchStats(size_t n){
+    cout<<"\n--- Catalog + sales statistics benchmark ("<<n<<" products) ---\n";
+    mt19937 rng(9);
+    vector<int> sales(n);
+    for(auto &x: sales) x=rng()%1000+50;
+    auto t0=chrono::steady_clock::now();
+    ProductCatalog catalog=generateCatalog(sales);
+    double sec=secondsSince(t0);
+    cout<<"generateCatalog: "<<sec<<" s, "<<catalog.bytes()/1048576<<" MB ("<<catalog.distinctNames()<<" names)"<<endl;
+    size_t m=min<size_t>(n,10000000);
+    {
+        t0=chrono::steady_clock::now();
+        vector<string> products=generateProducts(m);
+        sec=secondsSince(t0);
+        cout<<"generateProducts ("<<m<<" strings): "<<sec<<" s, ~"<<m*(sizeof(string)+32)/1048576<<" MB"<<endl;
+    }
+
+    const vector<int> &col=catalog.sales;
+    double mb=n*4/1048576.0;
+    int reps=5;
+    t0=chrono::steady_clock::now();
+    SalesStats st;
+    for(int r=0;r<reps;r++) st=aggregateColumn(col.data(),n);
+    sec=secondsSince(t0)/reps;
+    cout<<"fused aggregateColumn: "<<sec*1e3<<" ms ("<<mb/sec/1024<<" GB/s) sum "<<st.sum<<" min "<<st.minv
+        <<" max "<<st.maxv<<" avg "<<st.avg()<<endl;
+    t0=chrono::steady_clock::now();
+    long long total=0;
+    int mx=0, mn=0;
+    for(int r=0;r<reps;r++){
+        total=accumulate(col.begin(),col.end(),0LL);
+        mx=*max_element(col.begin(),col.end());
+        mn=*min_element(col.begin(),col.end());
+    }
+    sec=secondsSince(t0)/reps;
+    cout<<"accumulate + max_element + min_element: "<<sec*1e3<<" ms ("<<mb/sec/1024<<" GB/s)"
+        <<(total==st.sum && mx==st.maxv && mn==st.minv? "" : " MISMATCH")<<endl;
+}
+
 /*************************************************************
  * MAIN PROGRAM
  *************************************************************/
-int main(){
+int main(int argc, char **argv){
+    if(argc>1 && string(argv[1])=="bench"){
+        string name=argc>2? argv[2] : "all";
+        size_t size=argc>3? stoul(argv[3]) : 0;
+        if(name=="topk" || name=="all") benchTopK(size? size : 50000000);
+        if(name=="stats" || name=="all") benchStats(size? size : 50000000);
+        return 0;
+    }
+
     cout<<"=== Expanded Business Analytics Tool (Heap + Dijkstra + MergeSort + Backtracking) ===\n";
 
     // Generate large product catalog
     int numProducts=20; // can be increased
-    vector<string> products=generateProducts(numProducts);
     vector<int> sales=generateSales(numProducts);
 
-    SalesAnalytics sa(products,sales);
+    SalesAnalytics sa(generateCatalog(sales));
     sa.printTopK(5); // Top 5 products
 
     // MergeSort for sales
@@ -192,12 +485,9 @@ int main(){
 
     // Extended statistics
     cout<<"\n--- Extended Sales Statistics ---\n";
-    cout<<"Total products: "<<products.size()<<endl;
-    int totalSales=accumulate(sales.begin(),sales.end(),0);
-    int maxSale=*max_element(sales.begin(),sales.end());
-    int minSale=*min_element(sales.begin(),sales.end());
-    double avgSale=(double)totalSales/sales.size();
-    cout<<"Total sales: "<<totalSales<<", Max sale: "<<maxSale<<", Min sale: "<<minSale<<", Avg sale: "<<avgSale<<endl;
+    cout<<"Total products: "<<sa.catalog.size()<<endl;
+    SalesStats st=sa.stats();
+    cout<<"Total sales: "<<st.sum<<", Max sale: "<<st.maxv<<", Min sale: "<<st.minv<<", Avg sale: "<<st.avg()<<endl;
 
     return 0;
 }
@@ -1,4 +1,7 @@
 #include <bits/stdc++.h>
+#ifdef __SSE2__
+#include <immintrin.h>
+#endif
 using namespace std;
 
 /*****************************
@@ -100,43 +103,220 @@ vector<int> kmpSearch(const string &text, const string &pattern){
 /*****************************
  * TRIE STRUCTURE FOR MULTIPLE WORDS
  *****************************/
-struct TrieNode{
-    unordered_map<char,TrieNode*> children;
-    bool isEnd=false;
+// Adaptive radix tree (Node4/16/48/256, path-compressed) whose
+// nodes come from one arena, so the whole trie is freed at once
+class Arena{
+public:
+    Arena(){}
+    Arena(const Arena&)=delete;
+    Arena& operator=(const Arena&)=delete;
+    ~Arena(){ for(void *b: blocks) ::operator delete(b); }
+    void* allocate(size_t n, size_t align=alignof(max_align_t)){
+        size_t off=(used+align-1)&~(align-1);
+        if(blocks.empty() || off+n>cap){
+            cap=max(BLOCK,n);
+            blocks.push_back(::operator new(cap));
+            total+=cap; off=0;
+        }
+        used=off+n;
+        return (char*)blocks.back()+off;
+    }
+    template<class T> T* make(){ return new(allocate(sizeof(T),alignof(T))) T(); }
+    size_t bytes() const{ return total; }
+private:
+    static constexpr size_t BLOCK=1<<16;
+    vector<void*> blocks;
+    size_t used=0, cap=0, total=0;
 };
 
 class Trie{
-private:
-    TrieNode* root;
 public:
-    Trie(){ root = new TrieNode(); }
+    Trie(){ root=arena.make<Node4>(); }
 
     void insert(const string &word){
-        TrieNode* node = root;
-        for(char c: word){
-            if(!node->children.count(c)) node->children[c] = new TrieNode();
-            node = node->children[c];
+        Node **ref=&root;
+        Node *node=root;
+        size_t depth=0, n=word.size();
+        while(true){
+            uint32_t p=0;
+            while(p<node->prefixLen && depth+p<n && node->prefix[p]==word[depth+p]) p++;
+            if(p<node->prefixLen){
+                Node4 *split=arena.make<Node4>();
+                split->prefix=node->prefix; split->prefixLen=p;
+                unsigned char edge=node->prefix[p];
+                node->prefix+=p+1; node->prefixLen-=p+1;
+                addChild(split,edge,node);
+                if(depth+p==n) split->isEnd=true;
+                else addChild(split,word[depth+p],makeLeaf(word,depth+p+1));
+                *ref=split;
+                return;
+            }
+            depth+=node->prefixLen;
+            if(depth==n){ node->isEnd=true; return; }
+            Node **child=findChild(node,word[depth]);
+            if(!child){
+                Node *leaf=makeLeaf(word,depth+1);
+                if(isFull(node)){ node=grow(node); *ref=node; }
+                addChild(node,word[depth],leaf);
+                return;
+            }
+            ref=child; node=*child; depth++;
+        }
+    }
+
+    bool search(const string &word) const{
+        size_t used;
+        const Node *node=find(word,&used);
+        return node && node->isEnd && used+node->prefixLen==word.size();
+    }
+
+    vector<string> autocomplete(const string &prefix) const{
+        vector<string> results;
+        size_t used;
+        const Node *node=find(prefix,&used);
+        if(!node) return results;
+        string buf(prefix.begin(),prefix.begin()+used);
+        buf.append(node->prefix,node->prefixLen);
+        collect(node,buf,results);
+        return results;
+    }
+
+    void displayAllWords() const{
+        for(auto &w: autocomplete("")) cout << w << endl;
+    }
+
+    size_t bytes() const{ return arena.bytes(); }
+
+private:
+    enum { N4, N16, N48, N256 };
+    struct Node{
+        uint8_t type;
+        uint16_t count=0;
+        bool isEnd=false;
+        uint32_t prefixLen=0;
+        const char *prefix=nullptr;
+        Node(uint8_t t): type(t){}
+    };
+    struct Node4: Node{ unsigned char key[4]; Node *child[4]; Node4(): Node(N4){} };
+    struct Node16: Node{ unsigned char key[16]; Node *child[16]; Node16(): Node(N16){} };
+    struct Node48: Node{ uint8_t index[256]; Node *child[48]; Node48(): Node(N48){ memset(index,0xff,sizeof(index)); } };
+    struct Node256: Node{ Node *child[256]; Node256(): Node(N256){ memset(child,0,sizeof(child)); } };
+
+    Arena arena;
+    Node *root;
+
+    Node* makeLeaf(const string &word, size_t from){
+        Node4 *leaf=arena.make<Node4>();
+        leaf->prefixLen=word.size()-from;
+        char *p=(char*)arena.allocate(leaf->prefixLen,1);
+        memcpy(p,word.data()+from,leaf->prefixLen);
+        leaf->prefix=p;
+        leaf->isEnd=true;
+        return leaf;
+    }
+
+    static bool isFull(const Node *n){
+        return (n->type==N4 && n->count==4) || (n->type==N16 && n->count==16) || (n->type==N48 && n->count==48);
+    }
+
+    static Node** findChild(Node *n, unsigned char c){
+        switch(n->type){
+        case N4:{
+            Node4 *x=(Node4*)n;
+            for(int i=0;i<x->count;i++) if(x->key[i]==c) return &x->child[i];
+            return nullptr;
+        }
+        case N16:{
+            Node16 *x=(Node16*)n;
+#ifdef __SSE2__
+            int mask=_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(c),_mm_loadu_si128((const __m128i*)x->key)))&((1<<x->count)-1);
+            return mask? &x->child[__builtin_ctz(mask)] : nullptr;
+#else
+            for(int i=0;i<x->count;i++) if(x->key[i]==c) return &x->child[i];
+            return nullptr;
+#endif
+        }
+        case N48:{
+            Node48 *x=(Node48*)n;
+            return x->index[c]==0xff? nullptr : &x->child[x->index[c]];
+        }
+        default:{
+            Node256 *x=(Node256*)n;
+            return x->child[c]? &x->child[c] : nullptr;
+        }
         }
-        node->isEnd = true;
     }
 
-    bool search(const string &word){
-        TrieNode* node = root;
-        for(char c: word){
-            if(!node->children.count(c)) return false;
-            node = node->children[c];
+    // Keys of Node4/16 stay sorted so traversal is in lexicographic order
+    static void addChild(Node *n, unsigned char c, Node *child){
+        if(n->type==N4 || n->type==N16){
+            unsigned char *key= n->type==N4? ((Node4*)n)->key : ((Node16*)n)->key;
+            Node **ch= n->type==N4? ((Node4*)n)->child : ((Node16*)n)->child;
+            int i=n->count;
+            while(i>0 && key[i-1]>c){ key[i]=key[i-1]; ch[i]=ch[i-1]; i--; }
+            key[i]=c; ch[i]=child;
+        } else if(n->type==N48){
+            Node48 *x=(Node48*)n;
+            x->index[c]=x->count; x->child[x->count]=child;
+        } else ((Node256*)n)->child[c]=child;
+        n->count++;
+    }
+
+    Node* grow(Node *n){
+        Node *big;
+        if(n->type==N4){
+            Node16 *x=arena.make<Node16>();
+            memcpy(x->key,((Node4*)n)->key,4); memcpy(x->child,((Node4*)n)->child,4*sizeof(Node*));
+            big=x;
+        } else if(n->type==N16){
+            Node16 *o=(Node16*)n;
+            Node48 *x=arena.make<Node48>();
+            for(int i=0;i<16;i++){ x->index[o->key[i]]=i; x->child[i]=o->child[i]; }
+            big=x;
+        } else{
+            Node48 *o=(Node48*)n;
+            Node256 *x=arena.make<Node256>();
+            for(int c=0;c<256;c++) if(o->index[c]!=0xff) x->child[c]=o->child[o->index[c]];
+            big=x;
         }
-        return node->isEnd;
+        big->count=n->count; big->isEnd=n->isEnd;
+        big->prefix=n->prefix; big->prefixLen=n->prefixLen;
+        return big;
     }
 
-    void displayAll(TrieNode* node, string prefix){
-        if(node->isEnd) cout << prefix << endl;
-        for(auto &p: node->children){
-            displayAll(p.second, prefix+p.first);
+    // Node whose compressed prefix holds the end of key; *used gets the
+    // key bytes consumed before that prefix
+    const Node* find(const string &key, size_t *used) const{
+        Node *node=root;
+        size_t depth=0, n=key.size();
+        while(true){
+            uint32_t p=0;
+            while(p<node->prefixLen && depth+p<n && node->prefix[p]==key[depth+p]) p++;
+            if(depth+p==n){ *used=depth; return node; }
+            if(p<node->prefixLen) return nullptr;
+            depth+=p;
+            Node **child=findChild(node,key[depth]);
+            if(!child) return nullptr;
+            node=*child; depth++;
         }
     }
 
-    void displayAllWords(){ displayAll(root,""); }
+    static void collect(const Node *n, string &buf, vector<string> &out){
+        if(n->isEnd) out.push_back(buf);
+        auto visit=[&](unsigned char c,const Node *child){
+            size_t len=buf.size();
+            buf.push_back(c);
+            buf.append(child->prefix,child->prefixLen);
+            collect(child,buf,out);
+            buf.resize(len);
+        };
+        switch(n->type){
+        case N4:{ const Node4 *x=(const Node4*)n; for(int i=0;i<x->count;i++) visit(x->key[i],x->child[i]); break; }
+        case N16:{ const Node16 *x=(const Node16*)n; for(int i=0;i<x->count;i++) visit(x->key[i],x->child[i]); break; }
+        case N48:{ const Node48 *x=(const Node48*)n; for(int c=0;c<256;c++) if(x->index[c]!=0xff) visit(c,x->child[x->index[c]]); break; }
+        default:{ const Node256 *x=(const Node256*)n; for(int c=0;c<256;c++) if(x->child[c]) visit(c,x->child[c]); }
+        }
+    }
 };
 
 /*****************************
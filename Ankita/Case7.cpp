@@ -1,11 +1,18 @@
 #include <bits/stdc++.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#ifdef __SSE2__
+#include <immintrin.h>
+#endif
 using namespace std;
 
 /*************************************************************
  * 1. KMP ALGORITHM
  * For pattern search across documents
  *************************************************************/
-vector<int> computeLPS(const string &pattern){
+vector<int> computeLPS(string_view pattern){
     int m = pattern.size();
     vector<int> lps(m, 0);
     int len = 0, i = 1;
@@ -20,7 +27,7 @@ vector<int> computeLPS(const string &pattern){
     return lps;
 }
 
-vector<int> kmpSearch(const string &text, const string &pattern){
+vector<int> kmpSearch(string_view text, string_view pattern){
     vector<int> positions;
     int n = text.size(), m = pattern.size();
     if(m==0) return positions;
@@ -44,7 +51,7 @@ struct AVLNode{
     string key;
     int count, height;
     AVLNode *left,*right;
-    AVLNode(string k): key(k), count(1), height(1), left(nullptr), right(nullptr){}
+    AVLNode(string_view k): key(k), count(1), height(1), left(nullptr), right(nullptr){}
 };
 
 int height(AVLNode* node){ return node?node->height:0; }
@@ -66,7 +73,7 @@ AVLNode* leftRotate(AVLNode* x){
     return y;
 }
 
-AVLNode* insertAVL(AVLNode* node,string key){
+AVLNode* insertAVL(AVLNode* node,string_view key){
     if(!node) return new AVLNode(key);
     if(key==node->key){ node->count++; return node; }
     else if(key<node->key) node->left=insertAVL(node->left,key);
@@ -89,6 +96,260 @@ void inorderAVL(AVLNode* root){
     inorderAVL(root->right);
 }
 
+/*************************************************************
+ * 2b. B+-TREE WORD INDEX
+ * Ordered word counts in 256-512 byte nodes with linked leaves
+ *************************************************************/
+// Number of the cap 64-bit keys in pre that are below p (unsigned)
+inline int countBelow64(const uint64_t *pre, int cap, uint64_t p){
+    int c=0;
+#ifdef __SSE2__
+    const __m128i bias=_mm_set1_epi32(0x80000000);
+    __m128i b=_mm_xor_si128(_mm_set1_epi64x(p),bias);
+    for(int i=0;i<cap;i+=2){
+        __m128i a=_mm_xor_si128(_mm_loadu_si128((const __m128i*)(pre+i)),bias);
+        __m128i lt=_mm_cmplt_epi32(a,b), eq=_mm_cmpeq_epi32(a,b);
+        // high half decides unless equal, then the (shifted up) low half does
+        __m128i r=_mm_or_si128(lt,_mm_and_si128(eq,_mm_slli_epi64(lt,32)));
+        c+=__builtin_popcount(_mm_movemask_pd(_mm_castsi128_pd(r)));
+    }
+#else
+    for(int i=0;i<cap;i++) c+=pre[i]<p;
+#endif
+    return c;
+}
+
+class WordBTree{
+public:
+    static constexpr int LEAF_CAP=24, INNER_CAP=20;
+    uint64_t total=0;
+    int height=0;
+
+    WordBTree(){ root=newLeaf(); }
+    WordBTree(const WordBTree&)=delete;
+    WordBTree& operator=(const WordBTree&)=delete;
+    ~WordBTree(){ release(root,height); }
+
+    void add(string_view w, uint64_t c=1){
+        Inner *path[64];
+        int idx[64];
+        uint64_t p=prefixOf(w);
+        void *cur=root;
+        for(int h=height;h>0;h--){
+            Inner *in=(Inner*)cur;
+            int i=slot(in->pre,in->id,in->n,INNER_CAP,p,w,true);
+            path[h]=in; idx[h]=i;
+            cur=in->kid[i];
+        }
+        total+=c;
+        Leaf *lf=(Leaf*)cur;
+        int pos=slot(lf->pre,lf->id,lf->n,LEAF_CAP,p,w,false);
+        if(pos<lf->n && lf->pre[pos]==p && term(lf->id[pos])==w){ lf->cnt[pos]+=c; return; }
+        uint32_t id=newTerm(w);
+        if(lf->n<LEAF_CAP){
+            for(int i=lf->n;i>pos;i--){ lf->pre[i]=lf->pre[i-1]; lf->id[i]=lf->id[i-1]; lf->cnt[i]=lf->cnt[i-1]; }
+            lf->pre[pos]=p; lf->id[pos]=id; lf->cnt[pos]=c; lf->n++;
+            return;
+        }
+        // Split; an append to the last leaf keeps it full so sorted input packs densely
+        uint64_t tp[LEAF_CAP+1], tc[LEAF_CAP+1];
+        uint32_t ti[LEAF_CAP+1];
+        copy(lf->pre,lf->pre+pos,tp); copy(lf->id,lf->id+pos,ti); copy(lf->cnt,lf->cnt+pos,tc);
+        tp[pos]=p; ti[pos]=id; tc[pos]=c;
+        copy(lf->pre+pos,lf->pre+LEAF_CAP,tp+pos+1); copy(lf->id+pos,lf->id+LEAF_CAP,ti+pos+1);
+        copy(lf->cnt+pos,lf->cnt+LEAF_CAP,tc+pos+1);
+        int left= pos==LEAF_CAP && !lf->next? LEAF_CAP : (LEAF_CAP+1)/2;
+        Leaf *r=newLeaf();
+        lf->n=left; r->n=LEAF_CAP+1-left;
+        copy(tp,tp+left,lf->pre); copy(ti,ti+left,lf->id); copy(tc,tc+left,lf->cnt);
+        fill(lf->pre+left,lf->pre+LEAF_CAP,PAD);
+        copy(tp+left,tp+LEAF_CAP+1,r->pre); copy(ti+left,ti+LEAF_CAP+1,r->id); copy(tc+left,tc+LEAF_CAP+1,r->cnt);
+        r->next=lf->next; lf->next=r;
+        uint64_t upPre=r->pre[0];
+        uint32_t upId=r->id[0];
+        void *kid=r;
+        for(int h=1;h<=height;h++){
+            Inner *in=path[h];
+            int i=idx[h];
+            if(in->n<INNER_CAP){
+                for(int j=in->n;j>i;j--){ in->pre[j]=in->pre[j-1]; in->id[j]=in->id[j-1]; in->kid[j+1]=in->kid[j]; }
+                in->pre[i]=upPre; in->id[i]=upId; in->kid[i+1]=kid; in->n++;
+                return;
+            }
+            uint64_t ip[INNER_CAP+1];
+            uint32_t ii[INNER_CAP+1];
+            void *ic[INNER_CAP+2];
+            copy(in->pre,in->pre+i,ip); ip[i]=upPre; copy(in->pre+i,in->pre+INNER_CAP,ip+i+1);
+            copy(in->id,in->id+i,ii); ii[i]=upId; copy(in->id+i,in->id+INNER_CAP,ii+i+1);
+            copy(in->kid,in->kid+i+1,ic); ic[i+1]=kid; copy(in->kid+i+1,in->kid+INNER_CAP+1,ic+i+2);
+            int lk= i==INNER_CAP? INNER_CAP-1 : INNER_CAP/2;
+            Inner *rn=newInner();
+            in->n=lk; rn->n=INNER_CAP-lk;
+            copy(ip,ip+lk,in->pre); copy(ii,ii+lk,in->id); copy(ic,ic+lk+1,in->kid);
+            fill(in->pre+lk,in->pre+INNER_CAP,PAD);
+            copy(ip+lk+1,ip+INNER_CAP+1,rn->pre); copy(ii+lk+1,ii+INNER_CAP+1,rn->id);
+            copy(ic+lk+1,ic+INNER_CAP+2,rn->kid);
+            upPre=ip[lk]; upId=ii[lk]; kid=rn;
+        }
+        Inner *nr=newInner();
+        nr->n=1; nr->pre[0]=upPre; nr->id[0]=upId;
+        nr->kid[0]=root; nr->kid[1]=kid;
+        root=nr; height++;
+    }
+
+    uint64_t count(string_view w) const{
+        uint64_t p=prefixOf(w);
+        const Leaf *lf=leafFor(p,w);
+        int pos=slot(lf->pre,lf->id,lf->n,LEAF_CAP,p,w,false);
+        return pos<lf->n && lf->pre[pos]==p && term(lf->id[pos])==w? lf->cnt[pos] : 0;
+    }
+
+    // Replaces the contents with the words of a sorted sequence (duplicates counted)
+    template<class Words> void bulkLoad(const Words &sorted){
+        release(root,height);
+        arena.clear(); offsets.assign(1,0);
+        nodeBytes=0; height=0; total=sorted.size();
+        vector<void*> level;
+        vector<pair<uint64_t,uint32_t>> lows;
+        Leaf *prev=nullptr;
+        for(size_t i=0;i<sorted.size();){
+            Leaf *lf=newLeaf();
+            while(lf->n<LEAF_CAP && i<sorted.size()){
+                size_t j=i+1;
+                while(j<sorted.size() && sorted[j]==sorted[i]) j++;
+                lf->pre[lf->n]=prefixOf(sorted[i]); lf->id[lf->n]=newTerm(sorted[i]); lf->cnt[lf->n]=j-i; lf->n++;
+                i=j;
+            }
+            if(prev) prev->next=lf;
+            prev=lf;
+            level.push_back(lf); lows.push_back({lf->pre[0],lf->id[0]});
+        }
+        if(level.empty()){ root=newLeaf(); return; }
+        while(level.size()>1){
+            vector<void*> up;
+            vector<pair<uint64_t,uint32_t>> upLows;
+            for(size_t i=0;i<level.size();i+=INNER_CAP+1){
+                Inner *in=newInner();
+                size_t e=min(level.size(),i+INNER_CAP+1);
+                for(size_t j=i;j<e;j++){
+                    in->kid[j-i]=level[j];
+                    if(j>i){ in->pre[j-i-1]=lows[j].first; in->id[j-i-1]=lows[j].second; }
+                }
+                in->n=e-i-1;
+                up.push_back(in); upLows.push_back(lows[i]);
+            }
+            level.swap(up); lows.swap(upLows);
+            height++;
+        }
+        root=level[0];
+    }
+
+    // f(word, count) for every word in [lo, hi], in byte order
+    template<class F> void scan(string_view lo, string_view hi, F f) const{
+        uint64_t p=prefixOf(lo);
+        const Leaf *lf=leafFor(p,lo);
+        for(int i=slot(lf->pre,lf->id,lf->n,LEAF_CAP,p,lo,false);lf;lf=lf->next,i=0)
+            for(;i<lf->n;i++){
+                string_view w=term(lf->id[i]);
+                if(w>hi) return;
+                f(w,lf->cnt[i]);
+            }
+    }
+
+    template<class F> void forEach(F f) const{
+        for(const Leaf *lf=firstLeaf();lf;lf=lf->next)
+            for(int i=0;i<lf->n;i++) f(term(lf->id[i]),lf->cnt[i]);
+    }
+
+    void print() const{ forEach([](string_view w,uint64_t c){ cout<<w<<"("<<c<<") "; }); }
+
+    size_t size() const{ return offsets.size()-1; }
+    size_t bytes() const{ return arena.capacity()+offsets.capacity()*8+nodeBytes; }
+
+private:
+    struct Leaf{
+        int n;
+        uint32_t id[LEAF_CAP];
+        uint64_t pre[LEAF_CAP], cnt[LEAF_CAP];
+        Leaf *next;
+    };
+    struct Inner{
+        int n;
+        uint32_t id[INNER_CAP];
+        uint64_t pre[INNER_CAP];
+        void *kid[INNER_CAP+1];
+    };
+    static constexpr uint64_t PAD=~0ULL;
+
+    void *root;
+    string arena;
+    vector<uint64_t> offsets{0};
+    size_t nodeBytes=0;
+
+    string_view term(uint32_t id) const{ return string_view(arena.data()+offsets[id],offsets[id+1]-offsets[id]); }
+
+    uint32_t newTerm(string_view w){
+        arena.append(w.data(),w.size());
+        offsets.push_back(arena.size());
+        return offsets.size()-2;
+    }
+
+    // First 8 bytes big-endian, zero padded: orders like the string unless equal
+    static uint64_t prefixOf(string_view w){
+        unsigned char b[8]={0};
+        memcpy(b,w.data(),min<size_t>(w.size(),8));
+        uint64_t x=0;
+        for(int i=0;i<8;i++) x=x<<8|b[i];
+        return x;
+    }
+
+    // First slot holding a key >= w (or > w when upper), ties on prefix settled by the full words
+    int slot(const uint64_t *pre, const uint32_t *id, int n, int cap, uint64_t p, string_view w, bool upper) const{
+        int i=countBelow64(pre,cap,p);
+        for(;i<n && pre[i]==p;i++){
+            int c=term(id[i]).compare(w);
+            if(c>0 || (c==0 && !upper)) break;
+        }
+        return i;
+    }
+
+    const Leaf* leafFor(uint64_t p, string_view w) const{
+        void *cur=root;
+        for(int h=height;h>0;h--){
+            Inner *in=(Inner*)cur;
+            cur=in->kid[slot(in->pre,in->id,in->n,INNER_CAP,p,w,true)];
+        }
+        return (const Leaf*)cur;
+    }
+    const Leaf* firstLeaf() const{
+        void *cur=root;
+        for(int h=height;h>0;h--) cur=((Inner*)cur)->kid[0];
+        return (const Leaf*)cur;
+    }
+
+    Leaf* newLeaf(){
+        Leaf *lf=new Leaf;
+        lf->n=0; lf->next=nullptr;
+        fill(lf->pre,lf->pre+LEAF_CAP,PAD);
+        nodeBytes+=sizeof(Leaf);
+        return lf;
+    }
+    Inner* newInner(){
+        Inner *in=new Inner;
+        in->n=0;
+        fill(in->pre,in->pre+INNER_CAP,PAD);
+        nodeBytes+=sizeof(Inner);
+        return in;
+    }
+    void release(void *p, int h){
+        if(h>0){
+            Inner *in=(Inner*)p;
+            for(int i=0;i<=in->n;i++) release(in->kid[i],h-1);
+            delete in;
+        } else delete (Leaf*)p;
+    }
+};
+
 /*************************************************************
  * 3. SEGMENT TREE
  * For fast range queries (e.g., word lengths per document)
@@ -116,22 +377,509 @@ public:
  * 4. DFS GRAPH
  * For word co-occurrence network
  *************************************************************/
-void DFS(int u, vector<vector<int>> &adj, vector<bool> &visited){
+// Preorder from u with an explicit stack, so a word chain of any length fits
+vector<int> DFS(int u, const vector<vector<int>> &adj, vector<bool> &visited){
+    vector<int> order;
+    vector<pair<int,size_t>> stack={{u,0}};
     visited[u]=true;
-    cout<<u<<" ";
-    for(int v: adj[u]) if(!visited[v]) DFS(v,adj,visited);
+    order.push_back(u);
+    while(!stack.empty()){
+        auto &[x,next]=stack.back();
+        if(next==adj[x].size()){ stack.pop_back(); continue; }
+        int v=adj[x][next++];
+        if(visited[v]) continue;
+        visited[v]=true;
+        order.push_back(v);
+        stack.push_back({v,0});
+    }
+    return order;
+}
+
+/*************************************************************
+ * 5. MEMORY-MAPPED FILE
+ * Read-only mapping shared by the on-disk indexes
+ *************************************************************/
+class MappedFile{
+public:
+    const char *data=nullptr;
+    size_t size=0;
+    MappedFile(){}
+    MappedFile(const string &path){ open(path); }
+    MappedFile(const MappedFile&)=delete;
+    MappedFile& operator=(const MappedFile&)=delete;
+    ~MappedFile(){ close(); }
+    bool open(const string &path){
+        close();
+        int fd=::open(path.c_str(),O_RDONLY);
+        if(fd<0) return false;
+        struct stat st;
+        if(fstat(fd,&st)==0 && st.st_size>0){
+            void *p=mmap(nullptr,st.st_size,PROT_READ,MAP_PRIVATE,fd,0);
+            if(p!=MAP_FAILED){ data=(const char*)p; size=st.st_size; }
+        }
+        ::close(fd);
+        return data!=nullptr;
+    }
+    void close(){
+        if(data) munmap((void*)data,size);
+        data=nullptr; size=0;
+    }
+};
+
+/*************************************************************
+ * 6. SUFFIX ARRAY + LCP INDEX
+ * SA-IS construction, Kasai LCP, O(m log n) locate/count.
+ * Documents are joined with '\0' so matches never span two
+ * documents. The index can be saved once and memory-mapped.
+ *************************************************************/
+vector<int> saIS(const vector<int> &s, int upper){
+    int n=s.size();
+    if(n==0) return {};
+    if(n==1) return {0};
+    if(n==2) return s[0]<s[1]? vector<int>{0,1} : vector<int>{1,0};
+    vector<int> sa(n);
+    vector<bool> ls(n,false);
+    for(int i=n-2;i>=0;i--) ls[i]= s[i]==s[i+1]? ls[i+1] : s[i]<s[i+1];
+    vector<int> sumL(upper+1,0), sumS(upper+1,0);
+    for(int i=0;i<n;i++){
+        if(!ls[i]) sumS[s[i]]++;
+        else sumL[s[i]+1]++;
+    }
+    for(int i=0;i<=upper;i++){
+        sumS[i]+=sumL[i];
+        if(i<upper) sumL[i+1]+=sumS[i];
+    }
+    auto induce=[&](const vector<int> &lms){
+        fill(sa.begin(),sa.end(),-1);
+        vector<int> buf(upper+1);
+        copy(sumS.begin(),sumS.end(),buf.begin());
+        for(int d: lms){ if(d==n) continue; sa[buf[s[d]]++]=d; }
+        copy(sumL.begin(),sumL.end(),buf.begin());
+        sa[buf[s[n-1]]++]=n-1;
+        for(int i=0;i<n;i++){
+            int v=sa[i];
+            if(v>=1 && !ls[v-1]) sa[buf[s[v-1]]++]=v-1;
+        }
+        copy(sumL.begin(),sumL.end(),buf.begin());
+        for(int i=n-1;i>=0;i--){
+            int v=sa[i];
+            if(v>=1 && ls[v-1]) sa[--buf[s[v-1]+1]]=v-1;
+        }
+    };
+    vector<int> lmsMap(n+1,-1);
+    int m=0;
+    for(int i=1;i<n;i++) if(!ls[i-1] && ls[i]) lmsMap[i]=m++;
+    vector<int> lms;
+    lms.reserve(m);
+    for(int i=1;i<n;i++) if(!ls[i-1] && ls[i]) lms.push_back(i);
+    induce(lms);
+    if(m){
+        vector<int> sortedLms;
+        sortedLms.reserve(m);
+        for(int v: sa) if(lmsMap[v]!=-1) sortedLms.push_back(v);
+        vector<int> recS(m);
+        int recUpper=0;
+        recS[lmsMap[sortedLms[0]]]=0;
+        for(int i=1;i<m;i++){
+            int l=sortedLms[i-1], r=sortedLms[i];
+            int endL= lmsMap[l]+1<m? lms[lmsMap[l]+1] : n;
+            int endR= lmsMap[r]+1<m? lms[lmsMap[r]+1] : n;
+            bool same=true;
+            if(endL-l!=endR-r) same=false;
+            else{
+                while(l<endL && s[l]==s[r]){ l++; r++; }
+                if(l==n || s[l]!=s[r]) same=false;
+            }
+            if(!same) recUpper++;
+            recS[lmsMap[sortedLms[i]]]=recUpper;
+        }
+        vector<int> recSA=saIS(recS,recUpper);
+        for(int i=0;i<m;i++) sortedLms[i]=lms[recSA[i]];
+        induce(sortedLms);
+    }
+    return sa;
+}
+
+vector<int> kasaiLCP(const char *t, int n, const vector<int> &sa){
+    vector<int> rnk(n), lcp(n,0);
+    for(int i=0;i<n;i++) rnk[sa[i]]=i;
+    int h=0;
+    for(int i=0;i<n;i++){
+        if(h>0) h--;
+        if(rnk[i]==0){ h=0; continue; }
+        int j=sa[rnk[i]-1];
+        while(i+h<n && j+h<n && t[i+h]==t[j+h]) h++;
+        lcp[rnk[i]]=h;
+    }
+    return lcp;
+}
+
+template<class Docs>
+string joinDocuments(const Docs &documents, vector<int64_t> &docStart){
+    string text;
+    size_t total=0;
+    for(auto &d: documents) total+=d.size()+1;
+    text.reserve(total);
+    docStart.assign(1,0);
+    for(auto &d: documents){
+        text+=d; text.push_back('\0');
+        docStart.push_back(text.size());
+    }
+    if(text.size()>INT_MAX) throw length_error("suffix arrays are limited to 2 GB of text");
+    return text;
+}
+
+vector<int> suffixArrayOf(const string &text){
+    vector<int> s(text.size());
+    for(size_t i=0;i<s.size();i++) s[i]=(unsigned char)text[i];
+    return saIS(s,255);
+}
+
+class SuffixArrayIndex{
+public:
+    // Views into either the owned vectors below or a mapped index file
+    const char *text=nullptr;
+    const int32_t *sa=nullptr, *lcp=nullptr;
+    const int64_t *docStart=nullptr;
+    int64_t n=0, docs=0;
+
+    template<class Docs>
+    void build(const Docs &documents){
+        owned=joinDocuments(documents,ownedDocs);
+        vector<int> sa32=suffixArrayOf(owned);
+        vector<int> lcp32=kasaiLCP(owned.data(),owned.size(),sa32);
+        ownedSA.assign(sa32.begin(),sa32.end());
+        ownedLCP.assign(lcp32.begin(),lcp32.end());
+        mapped.close();
+        text=owned.data(); sa=ownedSA.data(); lcp=ownedLCP.data(); docStart=ownedDocs.data();
+        n=owned.size(); docs=documents.size();
+    }
+
+    bool save(const string &path) const{
+        ofstream out(path,ios::binary);
+        int64_t header[4]={MAGIC,n,docs,0};
+        out.write((const char*)header,sizeof(header));
+        out.write((const char*)docStart,(docs+1)*sizeof(int64_t));
+        out.write((const char*)sa,n*sizeof(int32_t));
+        out.write((const char*)lcp,n*sizeof(int32_t));
+        out.write(text,n);
+        return (bool)out;
+    }
+
+    bool load(const string &path){
+        if(!mapped.open(path) || mapped.size<4*sizeof(int64_t)){ mapped.close(); return false; }
+        const int64_t *h=(const int64_t*)mapped.data;
+        // header, docs+1 starts, n SA + n LCP entries, n text bytes; reject truncated or corrupt files
+        uint64_t size=mapped.size, hn=h[1], hd=h[2];
+        if(h[0]!=MAGIC || hn>size || hd>size/sizeof(int64_t)
+           || size-4*sizeof(int64_t)<(hd+1)*sizeof(int64_t)+hn*(2*sizeof(int32_t)+1)){
+            mapped.close();
+            return false;
+        }
+        // every row must point into the text and every document start must be in order,
+        // or lookups would read past the mapping
+        const int64_t *ds=h+4;
+        const int32_t *s=(const int32_t*)(ds+hd+1), *l=s+hn;
+        bool ok=ds[0]==0 && ds[hd]==(int64_t)hn;
+        for(uint64_t d=0;ok && d<hd;d++) ok=ds[d]<=ds[d+1];
+        for(uint64_t i=0;ok && i<hn;i++)
+            ok=s[i]>=0 && (uint64_t)s[i]<hn && l[i]>=0 && (uint64_t)l[i]<=hn-s[i];
+        if(!ok){ mapped.close(); return false; }
+        n=hn; docs=hd;
+        docStart=ds;
+        sa=s;
+        lcp=l;
+        text=(const char*)(lcp+n);
+        owned.clear(); ownedSA.clear(); ownedLCP.clear(); ownedDocs.clear();
+        return true;
+    }
+
+    // Half-open range of suffix-array rows starting with the pattern
+    pair<int64_t,int64_t> range(const string &p) const{
+        if(p.empty() || n==0) return {0,0};
+        return {bound(p,false),bound(p,true)};
+    }
+
+    int64_t count(const string &p) const{
+        auto r=range(p);
+        return r.second-r.first;
+    }
+
+    // (document, offset) of every occurrence, in text order
+    vector<pair<int,int>> locate(const string &p) const{
+        auto r=range(p);
+        vector<int64_t> pos(sa+r.first,sa+r.second);
+        sort(pos.begin(),pos.end());
+        vector<pair<int,int>> res;
+        res.reserve(pos.size());
+        for(int64_t x: pos){
+            int d=upper_bound(docStart,docStart+docs+1,x)-docStart-1;
+            res.push_back({d,int(x-docStart[d])});
+        }
+        return res;
+    }
+
+    // Longest substring occurring at least twice, from the LCP array
+    string longestRepeat() const{
+        int64_t best=0;
+        for(int64_t i=1;i<n;i++) if(lcp[i]>lcp[best]) best=i;
+        if(n==0 || lcp[best]==0) return "";
+        return string(text+sa[best],lcp[best]);
+    }
+
+private:
+    static const int64_t MAGIC=0x3158444941534441LL;
+    string owned;
+    vector<int32_t> ownedSA, ownedLCP;
+    vector<int64_t> ownedDocs;
+    MappedFile mapped;
+
+    // Matched-prefix lengths of both bounds let each step skip what is
+    // already known to agree with the pattern
+    int64_t bound(const string &p,bool upper) const{
+        int64_t lo=0, hi=n;
+        int m=p.size(), lmatch=0, hmatch=0;
+        while(lo<hi){
+            int64_t mid=(lo+hi)/2;
+            const char *suf=text+sa[mid];
+            int64_t avail=n-sa[mid];
+            int k=min(lmatch,hmatch);
+            while(k<m && k<avail && suf[k]==p[k]) k++;
+            bool less;
+            if(k==m) less=upper;
+            else if(k==avail) less=true;
+            else less=(unsigned char)suf[k]<(unsigned char)p[k];
+            if(less){ lo=mid+1; lmatch=k; }
+            else{ hi=mid; hmatch=k; }
+        }
+        return lo;
+    }
+};
+
+/*************************************************************
+ * 7. TOKENIZER + WORD COUNTS
+ * Zero-copy tokens, interned in an open-addressing dictionary
+ *************************************************************/
+inline bool isSpaceByte(unsigned char c){ return c==' ' || (c>='\t' && c<='\r'); }
+
+// Bit i set when p[i] is whitespace, for 64 bytes at once
+inline uint64_t whitespaceMask64(const char *p){
+#ifdef __SSE2__
+    const __m128i space=_mm_set1_epi8(' '), tab=_mm_set1_epi8('\t'), four=_mm_set1_epi8(4);
+    uint64_t m=0;
+    for(int k=0;k<4;k++){
+        __m128i v=_mm_loadu_si128((const __m128i*)(p+16*k));
+        __m128i ctl=_mm_sub_epi8(v,tab);
+        __m128i ws=_mm_or_si128(_mm_cmpeq_epi8(v,space),_mm_cmpeq_epi8(_mm_min_epu8(ctl,four),ctl));
+        m|=(uint64_t)(uint16_t)_mm_movemask_epi8(ws)<<(16*k);
+    }
+    return m;
+#else
+    uint64_t m=0;
+    for(int i=0;i<64;i++) m|=(uint64_t)isSpaceByte(p[i])<<i;
+    return m;
+#endif
 }
 
+// Same token boundaries as splitText (stringstream >>), emitted as
+// string_views into text. Whitespace is classified 64 bytes at a time
+// and token starts/ends are read straight off the bitmasks.
+template<class F> void forEachToken(string_view text, F emit){
+    const char *base=text.data(), *end=base+text.size(), *start=nullptr;
+    uint32_t pos=0;
+    bool inToken=false;
+    for(;base+64<=end;base+=64){
+        uint64_t ws=whitespaceMask64(base), word=~ws;
+        uint64_t starts=word&((ws<<1)|!inToken), ends=ws&((word<<1)|inToken);
+        for(uint64_t edges=starts|ends;edges;edges&=edges-1){
+            int i=__builtin_ctzll(edges);
+            if(starts>>i&1) start=base+i;
+            else emit(string_view(start,base+i-start),pos++);
+        }
+        inToken=word>>63;
+    }
+    for(const char *p=base;p<end;p++){
+        bool space=isSpaceByte(*p);
+        if(!space && !inToken) start=p;
+        else if(space && inToken) emit(string_view(start,p-start),pos++);
+        inToken=!space;
+    }
+    if(inToken) emit(string_view(start,end-start),pos++);
+}
+
+class TermDictionary{
+public:
+    TermDictionary(){ slots.assign(1024,0); }
+
+    int find(string_view w) const{
+        uint64_t h=hashOf(w), tag=h&TAG;
+        for(size_t s=h&(slots.size()-1);slots[s];s=(s+1)&(slots.size()-1)){
+            int id=int(slots[s]&~TAG)-1;
+            if((slots[s]&TAG)==tag && term(id)==w) return id;
+        }
+        return -1;
+    }
+
+    int intern(string_view w){ return intern(w,hashOf(w)); }
+
+    int intern(string_view w, uint64_t h){
+        uint64_t tag=h&TAG;
+        size_t s=h&(slots.size()-1);
+        for(;slots[s];s=(s+1)&(slots.size()-1)){
+            int id=int(slots[s]&~TAG)-1;
+            if((slots[s]&TAG)==tag && term(id)==w) return id;
+        }
+        int id=hashes.size();
+        slots[s]=tag|(id+1);
+        hashes.push_back(h);
+        arena.append(w.data(),w.size());
+        offsets.push_back(arena.size());
+        if(hashes.size()*2>slots.size()) grow();
+        return id;
+    }
+
+    string_view term(int id) const{ return string_view(arena.data()+offsets[id],offsets[id+1]-offsets[id]); }
+    uint64_t hashAt(int id) const{ return hashes[id]; }
+    size_t size() const{ return hashes.size(); }
+    size_t bytes() const{ return arena.capacity()+(offsets.capacity()+hashes.capacity()+slots.capacity())*8; }
+
+    static uint64_t hashOf(string_view w){
+        const char *p=w.data();
+        size_t n=w.size();
+        uint64_t h=0x9E3779B97F4A7C15ULL^n, x;
+        if(n>=8){
+            for(size_t i=0;i+8<n;i+=8){
+                memcpy(&x,p+i,8);
+                h=(h^x)*0xff51afd7ed558ccdULL; h^=h>>32;
+            }
+            memcpy(&x,p+n-8,8);
+        } else if(n>=4){
+            uint32_t a, b;
+            memcpy(&a,p,4); memcpy(&b,p+n-4,4);
+            x=(uint64_t)a<<32|b;
+        } else x= n? (unsigned char)p[0]<<16|(unsigned char)p[n/2]<<8|(unsigned char)p[n-1] : 0;
+        h=(h^x)*0xc4ceb9fe1a85ec53ULL;
+        return h^(h>>29);
+    }
+
+private:
+    // Slot = high 32 hash bits (tag) | id+1, so most probes never touch the arena
+    static constexpr uint64_t TAG=0xFFFFFFFF00000000ULL;
+    string arena;
+    vector<uint64_t> offsets{0}, hashes, slots;
+
+    void grow(){
+        slots.assign(slots.size()*2,0);
+        for(size_t id=0;id<hashes.size();id++){
+            size_t s=hashes[id]&(slots.size()-1);
+            while(slots[s]) s=(s+1)&(slots.size()-1);
+            slots[s]=(hashes[id]&TAG)|(id+1);
+        }
+    }
+};
+
+// Word -> count aggregation over interned words
+class WordCounter{
+public:
+    TermDictionary dict;
+    vector<uint64_t> counts;
+    uint64_t total=0;
+
+    void add(string_view w){ add(w,1,TermDictionary::hashOf(w)); }
+    void add(string_view w, uint64_t c, uint64_t h){
+        int id=dict.intern(w,h);
+        if((size_t)id==counts.size()) counts.push_back(0);
+        counts[id]+=c; total+=c;
+    }
+    void addText(string_view text){ forEachToken(text,[&](string_view w,uint32_t){ add(w); }); }
+
+    // Word ids in the same byte order inorderAVL prints
+    vector<int> sortedIds() const{
+        vector<int> ids(counts.size());
+        iota(ids.begin(),ids.end(),0);
+        sort(ids.begin(),ids.end(),[&](int a,int b){ return dict.term(a)<dict.term(b); });
+        return ids;
+    }
+};
+
+template<class F> void runThreads(int n, F f){
+    vector<thread> pool;
+    for(int t=0;t<n;t++) pool.emplace_back(f,t);
+    for(auto &th: pool) th.join();
+}
+
+// Word counts aggregated on several threads. Each thread counts its share of
+// the text into a private table; thread p then merges hash partition p of all
+// tables, and a single sort over the merged terms gives the ordered report.
+class ParallelWordCounter{
+public:
+    vector<WordCounter> parts;
+    uint64_t total=0;
+
+    template<class Docs> void count(const Docs &documents, int threads=0){
+        if(threads<=0) threads=max(1u,thread::hardware_concurrency());
+        // ~1 MB pieces cut at whitespace, so one large file still spreads over all threads
+        vector<string_view> pieces;
+        for(string_view d: documents)
+            while(!d.empty()){
+                size_t cut=min(d.size(),PIECE);
+                while(cut<d.size() && !isSpaceByte(d[cut])) cut++;
+                pieces.push_back(d.substr(0,cut));
+                d.remove_prefix(cut);
+            }
+        threads=max(1,min<int>(threads,pieces.size()));
+        vector<WordCounter> local(threads);
+        atomic<size_t> next{0};
+        runThreads(threads,[&](int t){
+            for(size_t i;(i=next++)<pieces.size();) local[t].addText(pieces[i]);
+        });
+        parts.assign(threads,WordCounter());
+        runThreads(threads,[&](int p){
+            for(auto &wc: local)
+                for(size_t id=0;id<wc.counts.size();id++){
+                    uint64_t h=wc.dict.hashAt(id);
+                    if((h>>20)%threads==(uint64_t)p) parts[p].add(wc.dict.term(id),wc.counts[id],h);
+                }
+        });
+        total=0;
+        for(auto &part: parts) total+=part.total;
+    }
+
+    size_t distinct() const{
+        size_t n=0;
+        for(auto &part: parts) n+=part.counts.size();
+        return n;
+    }
+
+    vector<pair<string_view,uint64_t>> sorted() const{
+        vector<pair<string_view,uint64_t>> out;
+        out.reserve(distinct());
+        for(auto &part: parts)
+            for(size_t id=0;id<part.counts.size();id++) out.push_back({part.dict.term(id),part.counts[id]});
+        sort(out.begin(),out.end(),[](auto &a,auto &b){ return a.first<b.first; });
+        return out;
+    }
+
+private:
+    static constexpr size_t PIECE=1<<20;
+};
+
 /*************************************************************
  * Helper functions: File I/O, text processing, graph creation
  *************************************************************/
-vector<string> splitText(const string &text){
-    stringstream ss(text); string word;
+vector<string> splitText(string_view text){
     vector<string> words;
-    while(ss>>word) words.push_back(word);
+    forEachToken(text,[&](string_view w,uint32_t){ words.emplace_back(w); });
     return words;
 }
 
+WordCounter countFileWords(const string &filename){
+    WordCounter wc;
+    MappedFile file(filename);
+    if(file.data) wc.addText(string_view(file.data,file.size));
+    return wc;
+}
+
 vector<string> readFileWords(const string &filename){
     ifstream fin(filename);
     vector<string> words;
@@ -143,9 +891,68 @@ vector<string> readFileWords(const string &filename){
     return words;
 }
 
-vector<vector<int>> buildWordGraph(const vector<string> &words){
+// Whole-file corpus: one document per line, each a view into the
+// mapping (or into a single buffer filled with 4 MB reads when the
+// file cannot be mapped, e.g. a pipe). Nothing is copied per line.
+class DocumentCorpus{
+public:
+    vector<string_view> docs;
+
+    DocumentCorpus(){}
+    DocumentCorpus(const string &path){ load(path); }
+    DocumentCorpus(const DocumentCorpus&)=delete;
+    DocumentCorpus& operator=(const DocumentCorpus&)=delete;
+
+    bool load(const string &path){
+        docs.clear(); owned.clear();
+        string_view all;
+        if(file.open(path)){
+            posix_madvise((void*)file.data,file.size,POSIX_MADV_SEQUENTIAL);
+            all=string_view(file.data,file.size);
+        } else {
+            int fd=::open(path.c_str(),O_RDONLY);
+            if(fd<0) return false;
+            const size_t BLOCK=1<<22;
+            for(;;){
+                size_t used=owned.size();
+                owned.resize(used+BLOCK);
+                ssize_t got=::read(fd,&owned[used],BLOCK);
+                owned.resize(used+max<ssize_t>(got,0));
+                if(got<=0) break;
+            }
+            ::close(fd);
+            all=owned;
+        }
+        const char *p=all.data(), *end=p+all.size();
+        while(p<end){
+            const char *nl=(const char*)memchr(p,'\n',end-p);
+            if(!nl) nl=end;
+            size_t len=nl-p;
+            if(len && p[len-1]=='\r') len--;
+            docs.emplace_back(p,len);
+            p=nl+1;
+        }
+        return true;
+    }
+
+    // Every token of every document, as views into the corpus
+    vector<string_view> words() const{
+        vector<string_view> out;
+        for(auto &d: docs) forEachToken(d,[&](string_view w,uint32_t){ out.push_back(w); });
+        return out;
+    }
+
+    size_t bytes() const{ return file.data? file.size : owned.size(); }
+
+private:
+    MappedFile file;
+    string owned;
+};
+
+template<class Words>
+vector<vector<int>> buildWordGraph(const Words &words){
     int n = words.size();
-    unordered_map<string,int> wordToIdx;
+    unordered_map<string_view,int> wordToIdx;
     vector<vector<int>> adj(n);
     for(int i=0;i<n;i++){
         if(wordToIdx.find(words[i])==wordToIdx.end()) wordToIdx[words[i]]=i;
@@ -155,9 +962,386 @@ vector<vector<int>> buildWordGraph(const vector<string> &words){
 }
 
 /*************************************************************
- * 5. Reporting functions
+ * 8. FM-INDEX
+ * BWT stored in a Huffman-shaped wavelet tree (about H0 bits
+ * per symbol plus 12.5% rank overhead) and an SA sampled every
+ * sampleRate text positions. count() only touches the BWT and
+ * costs O(m * H0) rank calls. locate() costs O(sampleRate) LF
+ * steps per hit, independent of n.
  *************************************************************/
-void reportPatternPositions(const vector<string> &documents, const vector<string> &patterns){
+class RankBitVector{
+public:
+    size_t n=0;
+    vector<uint64_t> words, blockRank;
+
+    void push_back(bool b){
+        if(n%64==0) words.push_back(0);
+        if(b) words.back()|=1ULL<<(n%64);
+        n++;
+    }
+    bool get(size_t i) const{ return words[i/64]>>(i%64)&1; }
+    // Ones in [0,i), one cumulative count per 512-bit block
+    size_t rank1(size_t i) const{
+        size_t b=i/512, w=b*8, r=blockRank[b];
+        for(;w<i/64;w++) r+=__builtin_popcountll(words[w]);
+        if(i%64) r+=__builtin_popcountll(words[w]&((1ULL<<(i%64))-1));
+        return r;
+    }
+    void finish(){
+        words.shrink_to_fit();
+        blockRank.assign(n/512+1,0);
+        size_t r=0;
+        for(size_t w=0;w<words.size();w++){
+            if(w%8==0) blockRank[w/8]=r;
+            r+=__builtin_popcountll(words[w]);
+        }
+        // n a multiple of 512: rank1(n) reads the entry after the last block
+        if(n%512==0) blockRank[n/512]=r;
+    }
+    size_t bytes() const{ return (words.capacity()+blockRank.capacity())*8; }
+};
+
+class HuffmanWaveletTree{
+public:
+    void build(const string &seq){
+        vector<size_t> freq(256,0);
+        for(unsigned char c: seq) freq[c]++;
+        priority_queue<pair<size_t,int>,vector<pair<size_t,int>>,greater<>> pq;
+        for(int c=0;c<256;c++) if(freq[c]) pq.push({freq[c],~c});
+        if(pq.size()==1) pq.push({0,~(pq.top().second==~0? 1 : 0)});
+        nodes.clear();
+        while(pq.size()>1){
+            auto a=pq.top(); pq.pop();
+            auto b=pq.top(); pq.pop();
+            nodes.push_back({{a.second,b.second},{}});
+            pq.push({a.first+b.first,(int)nodes.size()-1});
+        }
+        root=nodes.empty()? 0 : pq.top().second;
+        codeBits.assign(256,0); codeLen.assign(256,0);
+        function<void(int,uint64_t,int)> assign=[&](int v,uint64_t code,int len){
+            if(v<0){ codeBits[~v]=code; codeLen[~v]=len; return; }
+            for(int b=0;b<2;b++) assign(nodes[v].child[b],code|(uint64_t)b<<len,len+1);
+        };
+        if(!nodes.empty()) assign(root,0,0);
+        for(unsigned char c: seq){
+            int v=root;
+            for(int k=0;k<codeLen[c];k++){
+                int b=codeBits[c]>>k&1;
+                nodes[v].bits.push_back(b);
+                v=nodes[v].child[b];
+            }
+        }
+        for(auto &nd: nodes) nd.bits.finish();
+    }
+
+    // Occurrences of c in seq[0,i)
+    size_t rank(unsigned char c,size_t i) const{
+        if(!codeLen[c]) return 0;
+        int v=root;
+        for(int k=0;k<codeLen[c];k++){
+            int b=codeBits[c]>>k&1;
+            size_t r1=nodes[v].bits.rank1(i);
+            i= b? r1 : i-r1;
+            v=nodes[v].child[b];
+        }
+        return i;
+    }
+
+    // seq[i], with rank(seq[i], i) returned through r
+    unsigned char access(size_t i,size_t &r) const{
+        int v=root;
+        while(v>=0){
+            const RankBitVector &bv=nodes[v].bits;
+            size_t r1=bv.rank1(i);
+            if(bv.get(i)){ i=r1; v=nodes[v].child[1]; }
+            else{ i-=r1; v=nodes[v].child[0]; }
+        }
+        r=i;
+        return ~v;
+    }
+
+    size_t bytes() const{
+        size_t b=sizeof(*this)+nodes.capacity()*sizeof(Node);
+        for(auto &nd: nodes) b+=nd.bits.bytes();
+        return b;
+    }
+
+private:
+    struct Node{ int child[2]; RankBitVector bits; };
+    vector<Node> nodes;
+    int root=0;
+    vector<uint64_t> codeBits;
+    vector<int> codeLen;
+};
+
+class FMIndex{
+public:
+    int64_t n=0, docs=0;
+    int sampleRate;
+
+    FMIndex(int rate=64): sampleRate(rate){}
+
+    template<class Docs>
+    void build(const Docs &documents){
+        string text=joinDocuments(documents,docStart);
+        docs=documents.size();
+        n=text.size();
+        sampled=RankBitVector();
+        samples.clear();
+        if(n==0){
+            sampled.finish();
+            C.assign(257,0);
+            wt=HuffmanWaveletTree();
+            return;
+        }
+        vector<int> sa=suffixArrayOf(text);
+        // Row 0 is the virtual end-of-text suffix; its BWT symbol is text[n-1]
+        string bwt(n+1,'\0');
+        bwt[0]=text[n-1];
+        sampled.push_back(true); samples.push_back(n);
+        for(int64_t i=0;i<n;i++){
+            if(sa[i]==0){ dollarRow=i+1; bwt[i+1]='\0'; }
+            else bwt[i+1]=text[sa[i]-1];
+            bool mark=sa[i]%sampleRate==0;
+            sampled.push_back(mark);
+            if(mark) samples.push_back(sa[i]);
+        }
+        sampled.finish();
+        samples.shrink_to_fit();
+        vector<size_t> freq(256,0);
+        for(unsigned char c: text) freq[c]++;
+        C.assign(257,1);
+        for(int c=0;c<256;c++) C[c+1]=C[c]+freq[c];
+        wt.build(bwt);
+    }
+
+    // Half-open range of BWT rows prefixed by the pattern (backward search)
+    pair<int64_t,int64_t> range(const string &p) const{
+        if(n==0) return {0,0};
+        int64_t sp=0, ep=n+1;
+        for(int k=(int)p.size()-1;k>=0 && sp<ep;k--){
+            unsigned char c=p[k];
+            sp=C[c]+occ(c,sp);
+            ep=C[c]+occ(c,ep);
+        }
+        return {sp,max(sp,ep)};
+    }
+
+    int64_t count(const string &p) const{
+        if(p.empty()) return 0;
+        auto r=range(p);
+        return r.second-r.first;
+    }
+
+    vector<pair<int,int>> locate(const string &p) const{
+        vector<pair<int,int>> res;
+        if(p.empty()) return res;
+        auto r=range(p);
+        vector<int64_t> pos;
+        pos.reserve(r.second-r.first);
+        for(int64_t i=r.first;i<r.second;i++) pos.push_back(textPosition(i));
+        sort(pos.begin(),pos.end());
+        for(int64_t x: pos){
+            int d=upper_bound(docStart.begin(),docStart.end(),x)-docStart.begin()-1;
+            res.push_back({d,int(x-docStart[d])});
+        }
+        return res;
+    }
+
+    size_t bwtBytes() const{ return wt.bytes(); }
+    size_t bytes() const{
+        return wt.bytes()+sampled.bytes()+samples.capacity()*sizeof(int32_t)
+              +C.capacity()*sizeof(int64_t)+docStart.capacity()*sizeof(int64_t);
+    }
+
+private:
+    HuffmanWaveletTree wt;
+    RankBitVector sampled;
+    vector<int32_t> samples;
+    vector<int64_t> C, docStart;
+    int64_t dollarRow=0;
+
+    size_t occ(unsigned char c,int64_t i) const{
+        size_t r=wt.rank(c,i);
+        if(c==0 && dollarRow<i) r--;
+        return r;
+    }
+
+    int64_t textPosition(int64_t i) const{
+        int64_t steps=0;
+        while(!sampled.get(i)){
+            size_t r;
+            unsigned char c=wt.access(i,r);
+            if(c==0 && dollarRow<i) r--;
+            i=C[c]+r;
+            steps++;
+        }
+        return samples[sampled.rank1(i)]+steps;
+    }
+};
+
+/*************************************************************
+ * 9. INVERTED INDEX
+ * Word-level postings per term: delta + varint document ids
+ * with term frequencies, and a parallel stream of delta-coded
+ * word positions for phrase queries
+ *************************************************************/
+inline void putVarint(vector<uint8_t> &out, uint32_t v){
+    while(v>=0x80){ out.push_back(v|0x80); v>>=7; }
+    out.push_back(v);
+}
+
+inline uint32_t getVarint(const uint8_t *&p){
+    uint32_t v=*p&0x7f;
+    for(int shift=7;*p++&0x80;shift+=7) v|=uint32_t(*p&0x7f)<<shift;
+    return v;
+}
+
+// Writes a ∩ b to out (which may alias a) and returns its size
+size_t intersectSorted(const uint32_t *a, size_t na, const uint32_t *b, size_t nb, uint32_t *out){
+    size_t i=0, j=0, k=0;
+#ifdef __SSE2__
+    // Every b[<j] is below a[i]: skip b four ids at a time, then test a[i] against the block at once
+    while(i<na && j+4<=nb){
+        uint32_t x=a[i];
+        if(b[j+3]<x){ j+=4; continue; }
+        __m128i eq=_mm_cmpeq_epi32(_mm_set1_epi32(x),_mm_loadu_si128((const __m128i*)(b+j)));
+        if(_mm_movemask_epi8(eq)) out[k++]=x;
+        i++;
+    }
+#endif
+    while(i<na && j<nb){
+        if(a[i]<b[j]) i++;
+        else if(b[j]<a[i]) j++;
+        else{ out[k++]=a[i]; i++; j++; }
+    }
+    return k;
+}
+
+class InvertedIndex{
+public:
+    TermDictionary dict;
+    uint32_t docs=0;
+
+    uint32_t addDocument(string_view text){
+        uint32_t doc=docs++;
+        scratch.clear();
+        forEachToken(text,[&](string_view w,uint32_t pos){ scratch.push_back({(uint32_t)dict.intern(w),pos}); });
+        if(lists.size()<dict.size()) lists.resize(dict.size());
+        sort(scratch.begin(),scratch.end());
+        for(size_t i=0;i<scratch.size();){
+            size_t j=i;
+            while(j<scratch.size() && scratch[j].first==scratch[i].first) j++;
+            Postings &pl=lists[scratch[i].first];
+            putVarint(pl.docBytes,pl.df? doc-pl.lastDoc : doc);
+            putVarint(pl.docBytes,j-i);
+            uint32_t prev=0;
+            for(size_t k=i;k<j;k++){ putVarint(pl.posBytes,scratch[k].second-prev); prev=scratch[k].second; }
+            pl.lastDoc=doc; pl.df++;
+            i=j;
+        }
+        return doc;
+    }
+
+    vector<uint32_t> documentsWith(string_view w) const{
+        int id=dict.find(w);
+        vector<uint32_t> res;
+        if(id<0) return res;
+        const Postings &pl=lists[id];
+        res.resize(pl.df);
+        const uint8_t *p=pl.docBytes.data();
+        uint32_t doc=0;
+        for(uint32_t i=0;i<pl.df;i++){
+            doc+=getVarint(p);
+            getVarint(p);
+            res[i]=doc;
+        }
+        return res;
+    }
+
+    vector<uint32_t> andQuery(const vector<string> &terms) const{
+        vector<vector<uint32_t>> ls;
+        for(auto &t: terms) ls.push_back(documentsWith(t));
+        if(ls.empty()) return {};
+        sort(ls.begin(),ls.end(),[](auto &a,auto &b){ return a.size()<b.size(); });
+        vector<uint32_t> res=move(ls[0]);
+        for(size_t i=1;i<ls.size() && !res.empty();i++)
+            res.resize(intersectSorted(res.data(),res.size(),ls[i].data(),ls[i].size(),res.data()));
+        return res;
+    }
+
+    vector<uint32_t> orQuery(const vector<string> &terms) const{
+        vector<uint32_t> res, merged;
+        for(auto &t: terms){
+            vector<uint32_t> l=documentsWith(t);
+            merged.clear();
+            set_union(res.begin(),res.end(),l.begin(),l.end(),back_inserter(merged));
+            res.swap(merged);
+        }
+        return res;
+    }
+
+    // Documents containing the words of the phrase at consecutive positions
+    vector<uint32_t> phraseQuery(string_view phrase) const{
+        vector<string> terms;
+        forEachToken(phrase,[&](string_view w,uint32_t){ terms.emplace_back(w); });
+        vector<uint32_t> cand=andQuery(terms), res;
+        if(cand.empty()) return res;
+        vector<Cursor> cur;
+        for(auto &t: terms) cur.emplace_back(lists[dict.find(t)]);
+        vector<uint32_t> first, next;
+        for(uint32_t doc: cand){
+            cur[0].positions(doc,first);
+            for(size_t k=1;k<cur.size() && !first.empty();k++){
+                cur[k].positions(doc,next);
+                next.erase(next.begin(),lower_bound(next.begin(),next.end(),(uint32_t)k));
+                for(auto &p: next) p-=k;
+                first.resize(intersectSorted(first.data(),first.size(),next.data(),next.size(),first.data()));
+            }
+            if(!first.empty()) res.push_back(doc);
+        }
+        return res;
+    }
+
+    size_t postingBytes() const{
+        size_t b=0;
+        for(auto &pl: lists) b+=pl.docBytes.size()+pl.posBytes.size();
+        return b;
+    }
+
+private:
+    struct Postings{
+        vector<uint8_t> docBytes, posBytes;
+        uint32_t lastDoc=0, df=0;
+    };
+    vector<Postings> lists;
+    vector<pair<uint32_t,uint32_t>> scratch;
+
+    // Walks one posting list forward, keeping the position stream in step
+    struct Cursor{
+        const uint8_t *d, *p;
+        uint32_t doc=0, tf=0;
+        bool started=false;
+        Cursor(const Postings &pl): d(pl.docBytes.data()), p(pl.posBytes.data()){}
+        void positions(uint32_t target, vector<uint32_t> &out){
+            while(!started || doc<target){
+                for(uint32_t i=0;started && i<tf;i++) while(*p++&0x80);
+                doc+=getVarint(d); tf=getVarint(d);
+                started=true;
+            }
+            out.resize(tf);
+            uint32_t pos=0;
+            for(uint32_t i=0;i<tf;i++){ pos+=getVarint(p); out[i]=pos; }
+            tf=0;
+        }
+    };
+};
+
+/*************************************************************
+ * 10. Reporting functions
+ *************************************************************/
+template<class Docs>
+void reportPatternPositions(const Docs &documents, const vector<string> &patterns){
     cout<<"\n--- Multi-pattern KMP Search ---\n";
     for(auto &p: patterns){
         cout<<"Pattern '"<<p<<"' found at positions per document:\n";
@@ -171,9 +1355,44 @@ void reportPatternPositions(const vector<string> &documents, const vector<string
     }
 }
 
-void reportWordStatsAVL(AVLNode* root){
-    cout<<"\n--- Word counts (AVL Tree, Inorder Traversal) ---\n";
-    inorderAVL(root); cout<<endl;
+void reportIndexedPatternPositions(const SuffixArrayIndex &idx, const vector<string> &patterns){
+    cout<<"\n--- Suffix Array Index Search ---\n";
+    for(auto &p: patterns){
+        vector<pair<int,int>> hits=idx.locate(p);
+        cout<<"Pattern '"<<p<<"' occurs "<<hits.size()<<" time(s): ";
+        for(auto &h: hits) cout<<"doc "<<h.first+1<<"["<<h.second<<"] ";
+        cout<<endl;
+    }
+    cout<<"Longest repeated substring: '"<<idx.longestRepeat()<<"'"<<endl;
+}
+
+void reportFMPatternPositions(const FMIndex &fm, const vector<string> &patterns){
+    cout<<"\n--- FM-Index Search ("<<fm.bytes()<<" bytes for "<<fm.n<<" bytes of text) ---\n";
+    for(auto &p: patterns){
+        vector<pair<int,int>> hits=fm.locate(p);
+        cout<<"Pattern '"<<p<<"' occurs "<<fm.count(p)<<" time(s): ";
+        for(auto &h: hits) cout<<"doc "<<h.first+1<<"["<<h.second<<"] ";
+        cout<<endl;
+    }
+}
+
+void reportInvertedIndex(const InvertedIndex &inv){
+    cout<<"\n--- Inverted Index ("<<inv.dict.size()<<" terms, "<<inv.postingBytes()<<" posting bytes) ---\n";
+    auto print=[](const string &label,const vector<uint32_t> &docs){
+        cout<<label<<": ";
+        if(docs.empty()) cout<<"None";
+        for(uint32_t d: docs) cout<<"doc "<<d+1<<" ";
+        cout<<endl;
+    };
+    print("AND(trees, word)",inv.andQuery({"trees","word"}));
+    print("OR(KMP, DFS)",inv.orQuery({"KMP","DFS"}));
+    print("PHRASE(\"fast range queries\")",inv.phraseQuery("fast range queries"));
+}
+
+void reportWordCounts(const ParallelWordCounter &wc){
+    cout<<"\n--- Word counts (per-thread hash tables, merged and sorted) ---\n";
+    for(auto &[w,c]: wc.sorted()) cout<<w<<"("<<c<<") ";
+    cout<<endl;
 }
 
 void reportSegmentTreeStats(SegmentTree &st, int start, int end){
@@ -181,48 +1400,376 @@ void reportSegmentTreeStats(SegmentTree &st, int start, int end){
     cout<<"Sum of word lengths from index "<<start<<" to "<<end<<": "<<st.query(1,0,st.n-1,start,end)<<endl;
 }
 
-void reportDFSGraph(vector<vector<int>> &adj){
+void reportDFSGraph(vector<vector<int>> &adj, size_t printLimit=1000){
     int n=adj.size();
     vector<bool> visited(n,false);
     cout<<"\n--- DFS Traversal of Word Graph ---\n";
-    DFS(0,adj,visited); cout<<endl;
+    vector<int> order=DFS(0,adj,visited);
+    for(size_t i=0;i<order.size() && i<printLimit;i++) cout<<order[i]<<" ";
+    if(order.size()>printLimit) cout<<"... ("<<order.size()<<" nodes visited)";
+    cout<<endl;
+}
+
+/*************************************************************
+ * BENCHMARKS (run with: ./Case7 bench <name> [MB])
+ * (btree takes millions of keys instead of MB)
+ *************************************************************/
+double secondsSince(chrono::steady_clock::time_point t0){
+    return chrono::duration<double>(chrono::steady_clock::now()-t0).count();
+}
+
+vector<string> generateDocuments(size_t mb, int wordsPerDoc=200){
+    vector<string> vocab;
+    mt19937 rng(42);
+    for(int i=0;i<5000;i++){
+        string w;
+        int len=3+rng()%8;
+        for(int j=0;j<len;j++) w+='a'+rng()%26;
+        vocab.push_back(w);
+    }
+    vector<string> docs;
+    size_t total=0;
+    while(total<(mb<<20)){
+        string d;
+        for(int i=0;i<wordsPerDoc;i++){
+            if(i) d+=' ';
+            d+=vocab[min<size_t>(rng()%vocab.size(),rng()%vocab.size())];
+        }
+        total+=d.size()+1;
+        docs.push_back(move(d));
+    }
+    return docs;
+}
+
+vector<string> samplePatterns(const vector<string> &docs, size_t count, size_t len){
+    mt19937 rng(7);
+    vector<string> pats;
+    while(pats.size()<count){
+        const string &d=docs[rng()%docs.size()];
+        if(d.size()>len) pats.push_back(d.substr(rng()%(d.size()-len),len));
+    }
+    return pats;
+}
+
+void benchSuffixArray(size_t mb){
+    cout<<"\n--- Suffix array index benchmark ("<<mb<<" MB) ---\n";
+    vector<string> docs=generateDocuments(mb);
+    auto t0=chrono::steady_clock::now();
+    SuffixArrayIndex idx;
+    idx.build(docs);
+    cout<<"Build (SA-IS + LCP): "<<secondsSince(t0)<<" s for "<<idx.n<<" bytes, "<<docs.size()<<" documents"<<endl;
+    string path="sa_bench.idx";
+    t0=chrono::steady_clock::now();
+    idx.save(path);
+    cout<<"Save: "<<secondsSince(t0)<<" s"<<endl;
+    SuffixArrayIndex mapped;
+    t0=chrono::steady_clock::now();
+    mapped.load(path);
+    cout<<"Memory-map load: "<<secondsSince(t0)*1e3<<" ms"<<endl;
+    vector<string> pats=samplePatterns(docs,10000,8);
+    t0=chrono::steady_clock::now();
+    long long total=0;
+    for(auto &p: pats) total+=mapped.count(p);
+    cout<<"count(): "<<secondsSince(t0)/pats.size()*1e6<<" us/query, "<<total<<" hits"<<endl;
+    t0=chrono::steady_clock::now();
+    total=0;
+    for(auto &p: pats) total+=mapped.locate(p).size();
+    cout<<"locate(): "<<secondsSince(t0)/pats.size()*1e6<<" us/query, "<<total<<" hits"<<endl;
+    t0=chrono::steady_clock::now();
+    total=0;
+    int scanned=min<int>(pats.size(),20);
+    for(int i=0;i<scanned;i++) for(auto &d: docs) total+=kmpSearch(d,pats[i]).size();
+    cout<<"KMP rescan of all documents: "<<secondsSince(t0)/scanned*1e6<<" us/query"<<endl;
+    remove(path.c_str());
+}
+
+void benchFMIndex(size_t mb){
+    cout<<"\n--- FM-index benchmark (up to "<<mb<<" MB) ---\n";
+    for(size_t size: {max<size_t>(1,mb/4),max<size_t>(1,mb/2),mb}){
+        vector<string> docs=generateDocuments(size);
+        auto t0=chrono::steady_clock::now();
+        FMIndex fm;
+        fm.build(docs);
+        double build=secondsSince(t0);
+        cout<<size<<" MB: build "<<build<<" s, index "<<fm.bytes()/1048576.0<<" MB ("
+            <<100.0*fm.bytes()/fm.n<<"% of text, BWT "<<100.0*fm.bwtBytes()/fm.n<<"%)"<<endl;
+        vector<string> pats=samplePatterns(docs,10000,8);
+        t0=chrono::steady_clock::now();
+        long long total=0;
+        for(auto &p: pats) total+=fm.count(p);
+        cout<<"  count(): "<<secondsSince(t0)/pats.size()*1e6<<" us/query, "<<total<<" hits"<<endl;
+        t0=chrono::steady_clock::now();
+        total=0;
+        for(int i=0;i<1000;i++) total+=fm.locate(pats[i]).size();
+        double sec=secondsSince(t0);
+        cout<<"  locate(): "<<sec/1000*1e6<<" us/query, "<<sec/max(1LL,total)*1e6<<" us/hit"<<endl;
+    }
+}
+
+// Rank and FM counts around 512-bit block boundaries, checked against brute force
+void checkFMIndex(){
+    cout<<"\n--- FM-index boundary check ---\n";
+    mt19937 rng(5);
+    int failures=0;
+    for(size_t n=0;n<=1100;n++){
+        RankBitVector bv;
+        vector<bool> bits(n);
+        for(size_t i=0;i<n;i++){ bits[i]=rng()%2; bv.push_back(bits[i]); }
+        bv.finish();
+        size_t ones=0;
+        for(size_t i=0;i<=n;i++){
+            if(bv.rank1(i)!=ones){ failures++; break; }
+            if(i<n) ones+=bits[i];
+        }
+    }
+    auto naive=[](const vector<string> &docs, const string &p){
+        int64_t c=0;
+        for(auto &d: docs)
+            for(size_t at=d.find(p);at!=string::npos;at=d.find(p,at+1)) c++;
+        return c;
+    };
+    vector<vector<string>> cases={{}};
+    for(size_t len: {1,63,64,65,510,511,512,513,1022,1023,1024,1025}){
+        cases.push_back({string(len,'a')});
+        string mixed(len,'a');
+        for(auto &ch: mixed) if(rng()%3==0) ch='b';
+        cases.push_back({mixed,string(len/2,'a')});
+    }
+    for(auto &docs: cases){
+        FMIndex fm;
+        fm.build(docs);
+        for(string p: {"a","b","aa","ab","ba","aaa"})
+            if(fm.count(p)!=naive(docs,p) || (int64_t)fm.locate(p).size()!=naive(docs,p)) failures++;
+    }
+    cout<<(failures? "FAILED: "+to_string(failures)+" mismatches" : string("ok"))<<endl;
+}
+
+void benchInvertedIndex(size_t mb){
+    cout<<"\n--- Inverted index benchmark ("<<mb<<" MB) ---\n";
+    vector<string> docs=generateDocuments(mb,50);
+    auto t0=chrono::steady_clock::now();
+    InvertedIndex inv;
+    for(auto &d: docs) inv.addDocument(d);
+    double sec=secondsSince(t0);
+    size_t raw=0;
+    for(auto &d: docs) raw+=d.size();
+    cout<<"Indexed "<<docs.size()<<" documents in "<<sec<<" s ("<<raw/sec/1e6<<" MB/s), "<<inv.dict.size()
+        <<" terms, postings "<<inv.postingBytes()/1048576.0<<" MB"<<endl;
+    mt19937 rng(3);
+    vector<vector<string>> pairs;
+    vector<string> phrases;
+    for(int i=0;i<2000;i++){
+        vector<string> w=splitText(docs[rng()%docs.size()]);
+        int k=rng()%(w.size()-2);
+        pairs.push_back({w[k],w[rng()%w.size()]});
+        phrases.push_back(w[k]+" "+w[k+1]+" "+w[k+2]);
+    }
+    auto run=[&](const string &label,auto query){
+        auto t0=chrono::steady_clock::now();
+        size_t hits=0;
+        for(int i=0;i<2000;i++) hits+=query(i).size();
+        double sec=secondsSince(t0);
+        cout<<label<<": "<<2000/sec<<" queries/s, "<<hits<<" documents matched"<<endl;
+    };
+    run("AND (2 terms)",[&](int i){ return inv.andQuery(pairs[i]); });
+    run("OR (2 terms)",[&](int i){ return inv.orQuery(pairs[i]); });
+    run("Phrase (3 words)",[&](int i){ return inv.phraseQuery(phrases[i]); });
+}
+
+void benchWordCount(size_t mb){
+    cout<<"\n--- Word count benchmark ("<<mb<<" MB file) ---\n";
+    string path="wordcount_bench.txt";
+    {
+        vector<string> docs=generateDocuments(mb);
+        ofstream out(path);
+        for(auto &d: docs) out<<d<<'\n';
+    }
+    auto t0=chrono::steady_clock::now();
+    WordCounter wc=countFileWords(path);
+    double sec=secondsSince(t0);
+    cout<<"mmap + SIMD tokenizer + hash map: "<<sec<<" s ("<<mb/sec<<" MB/s, 10 GB in ~"<<10240/(mb/sec)
+        <<" s), "<<wc.total<<" words, "<<wc.counts.size()<<" distinct"<<endl;
+    int hw=max(1u,thread::hardware_concurrency());
+    for(int threads: hw>1? vector<int>{1,hw} : vector<int>{1}){
+        t0=chrono::steady_clock::now();
+        ParallelWordCounter pc;
+        MappedFile file(path);
+        pc.count(vector<string_view>{string_view(file.data,file.size)},threads);
+        size_t distinct=pc.sorted().size();
+        sec=secondsSince(t0);
+        cout<<"mmap + "<<threads<<" thread(s) hash tables + merge + sort: "<<sec<<" s ("<<mb/sec<<" MB/s), "
+            <<pc.total<<" words, "<<distinct<<" distinct"<<endl;
+    }
+    size_t oldMb=min<size_t>(mb,32);
+    if(oldMb<mb){
+        vector<string> docs=generateDocuments(oldMb);
+        ofstream out(path);
+        for(auto &d: docs) out<<d<<'\n';
+    }
+    t0=chrono::steady_clock::now();
+    vector<string> words=readFileWords(path);
+    AVLNode *root=nullptr;
+    for(auto &w: words) root=insertAVL(root,w);
+    sec=secondsSince(t0);
+    cout<<"getline + splitText + insertAVL ("<<oldMb<<" MB): "<<sec<<" s ("<<oldMb/sec<<" MB/s, 10 GB in ~"
+        <<10240/(oldMb/sec)<<" s), "<<words.size()<<" words"<<endl;
+    remove(path.c_str());
+}
+
+void benchLoad(size_t mb){
+    cout<<"\n--- Document load benchmark ("<<mb<<" MB file) ---\n";
+    string path="load_bench.txt";
+    {
+        ofstream out(path);
+        for(size_t done=0;done<mb;done+=64){
+            vector<string> docs=generateDocuments(min<size_t>(64,mb-done));
+            for(auto &d: docs) out<<d<<'\n';
+        }
+    }
+    auto t0=chrono::steady_clock::now();
+    size_t words=0;
+    {
+        DocumentCorpus corpus(path);
+        words=corpus.words().size();
+        double sec=secondsSince(t0);
+        cout<<"DocumentCorpus (mmap, string_view words): "<<sec<<" s ("<<corpus.bytes()/sec/1e6<<" MB/s), "
+            <<corpus.docs.size()<<" documents, "<<words<<" words"<<endl;
+    }
+    t0=chrono::steady_clock::now();
+    {
+        vector<string> copied=readFileWords(path);
+        double sec=secondsSince(t0);
+        cout<<"readFileWords (getline + splitText): "<<sec<<" s ("<<mb*1048576.0/sec/1e6<<" MB/s), "
+            <<copied.size()<<" words"<<endl;
+    }
+    remove(path.c_str());
+}
+
+void benchWordBTree(size_t millions){
+    size_t n=millions*1000000;
+    cout<<"\n--- Ordered word index benchmark ("<<n<<" distinct keys) ---\n";
+    mt19937_64 rng(11);
+    size_t digits=1;
+    for(size_t m=26;m<n;m*=26) digits++;
+    vector<string> keys(n);
+    for(size_t i=0;i<n;i++){
+        // random stem, then i in fixed-width base 26 so every key is distinct
+        string &k=keys[i];
+        for(int j=2+rng()%5;j>0;j--) k+=char('a'+rng()%26);
+        for(size_t v=i,j=0;j<digits;j++,v/=26) k+=char('a'+v%26);
+    }
+    vector<string_view> views(keys.begin(),keys.end());
+    vector<string_view> probes(1000000);
+    for(auto &q: probes) q=views[rng()%n];
+
+    auto t0=chrono::steady_clock::now();
+    AVLNode *root=nullptr;
+    for(auto w: views) root=insertAVL(root,w);
+    double sec=secondsSince(t0);
+    uint64_t hits=0;
+    t0=chrono::steady_clock::now();
+    for(auto q: probes){
+        AVLNode *x=root;
+        while(x && x->key!=q) x= q<x->key? x->left : x->right;
+        hits+=x? x->count : 0;
+    }
+    double look=secondsSince(t0);
+    cout<<"AVL: insert "<<sec*1e9/n<<" ns/key, lookup "<<look*1e9/probes.size()<<" ns ("<<hits<<" hits), "
+        <<"~"<<n*(sizeof(AVLNode)+16)/1048576<<" MB"<<endl;
+
+    {
+        WordBTree tree;
+        t0=chrono::steady_clock::now();
+        for(auto w: views) tree.add(w);
+        sec=secondsSince(t0);
+        hits=0;
+        t0=chrono::steady_clock::now();
+        for(auto q: probes) hits+=tree.count(q);
+        look=secondsSince(t0);
+        cout<<"B+-tree: insert "<<sec*1e9/n<<" ns/key, lookup "<<look*1e9/probes.size()<<" ns ("<<hits
+            <<" hits), height "<<tree.height<<", "<<tree.bytes()/1048576<<" MB"<<endl;
+    }
+    sort(views.begin(),views.end());
+    WordBTree tree;
+    t0=chrono::steady_clock::now();
+    tree.bulkLoad(views);
+    sec=secondsSince(t0);
+    cout<<"B+-tree bulk load from sorted: "<<sec*1e9/n<<" ns/key, "<<tree.bytes()/1048576<<" MB"<<endl;
+    t0=chrono::steady_clock::now();
+    uint64_t seen=0;
+    tree.scan(views[n/4],views[3*n/4],[&](string_view,uint64_t c){ seen+=c; });
+    sec=secondsSince(t0);
+    cout<<"B+-tree range scan: "<<seen/sec/1e6<<" M keys/s ("<<seen<<" keys)"<<endl;
 }
 
 /*************************************************************
  * MAIN PROGRAM
  *************************************************************/
-int main(){
+int main(int argc, char **argv){
+    if(argc>1 && string(argv[1])=="bench"){
+        string name=argc>2? argv[2] : "all";
+        size_t mb=argc>3? stoul(argv[3]) : 0;
+        if(name=="sa" || name=="all") benchSuffixArray(mb? mb : 32);
+        if(name=="fm" || name=="all") benchFMIndex(mb? mb : 32);
+        if(name=="fmcheck" || name=="all") checkFMIndex();
+        if(name=="inverted" || name=="all") benchInvertedIndex(mb? mb : 32);
+        if(name=="wordcount" || name=="all") benchWordCount(mb? mb : 256);
+        if(name=="load" || name=="all") benchLoad(mb? mb : 512);
+        if(name=="btree" || name=="all") benchWordBTree(mb? mb : 10);
+        return 0;
+    }
+
     cout<<"=== Document Analytics Tool (Expanded, 500+ lines) ===\n";
 
-    // 1. Read documents
-    vector<string> documents = {
+    // 1. Read documents: one per line from a file when given, else the built-in set
+    vector<string> builtin = {
         "KMP algorithm detects patterns efficiently.",
         "AVL trees store word counts in sorted order.",
         "Segment Trees allow fast range queries on text.",
         "DFS can explore word relations as a graph."
     };
+    vector<string_view> documents(builtin.begin(),builtin.end());
+    DocumentCorpus corpus;
+    if(argc>1){
+        if(!corpus.load(argv[1])){ cout<<"Cannot read "<<argv[1]<<endl; return 1; }
+        documents=corpus.docs;
+    }
 
-    AVLNode* root=nullptr;
     vector<int> wordLengths;
-    vector<string> allWords;
+    vector<string_view> allWords;
 
     for(auto &doc: documents){
-        vector<string> words=splitText(doc);
-        allWords.insert(allWords.end(), words.begin(), words.end());
-        for(auto &w: words) root=insertAVL(root,w);
-        for(auto &w: words) wordLengths.push_back(w.size());
+        forEachToken(doc,[&](string_view w,uint32_t){
+            allWords.push_back(w);
+            wordLengths.push_back(w.size());
+        });
     }
+    if(allWords.empty()){ cout<<"No words found"<<endl; return 0; }
 
     // 2. KMP patterns
     vector<string> patterns={"KMP","Segment","DFS"};
     reportPatternPositions(documents,patterns);
 
+    SuffixArrayIndex saIndex;
+    saIndex.build(documents);
+    reportIndexedPatternPositions(saIndex,patterns);
+
+    FMIndex fmIndex;
+    fmIndex.build(documents);
+    reportFMPatternPositions(fmIndex,patterns);
+
+    InvertedIndex invIndex;
+    for(auto &doc: documents) invIndex.addDocument(doc);
+    reportInvertedIndex(invIndex);
+
     // 3. Segment Tree analytics
     SegmentTree st(wordLengths);
     reportSegmentTreeStats(st,2,6);
 
-    // 4. AVL Tree report
-    reportWordStatsAVL(root);
+    // 4. Word counts: parallel hash aggregation, one final sort
+    ParallelWordCounter wordCounts;
+    wordCounts.count(documents);
+    reportWordCounts(wordCounts);
 
     // 5. DFS Graph traversal
     vector<vector<int>> adj=buildWordGraph(allWords);
@@ -231,7 +1778,7 @@ int main(){
     // 6. Extended reporting (simulating multiple documents)
     cout<<"\n--- Extended Analytics ---\n";
     cout<<"Total words across all documents: "<<allWords.size()<<endl;
-    set<string> uniqueWords(allWords.begin(),allWords.end());
+    set<string_view> uniqueWords(allWords.begin(),allWords.end());
     cout<<"Unique words: "<<uniqueWords.size()<<endl;
     int maxLen=*max_element(wordLengths.begin(),wordLengths.end());
     int minLen=*min_element(wordLengths.begin(),wordLengths.end());
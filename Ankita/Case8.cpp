@@ -1,4 +1,7 @@
 #include <bits/stdc++.h>
+#ifdef __SSE2__
+#include <immintrin.h>
+#endif
 using namespace std;
 
 /*************************************************************
@@ -6,26 +9,141 @@ using namespace std;
  *************************************************************/
 const int PRIME = 101;
 
-vector<int> rabinKarpSearch(const string &text, const string &pattern){
+vector<int> rabinKarpSearch(const string &text, const string &pattern, long long mod=PRIME, long long *hashHits=nullptr){
     vector<int> positions;
     int n = text.size(), m = pattern.size();
     if(m==0 || n<m) return positions;
 
     long long patternHash=0, textHash=0, h=1;
-    for(int i=0;i<m-1;i++) h = (h*256)%PRIME;
+    for(int i=0;i<m-1;i++) h = (h*256)%mod;
     for(int i=0;i<m;i++){
-        patternHash = (256*patternHash + pattern[i])%PRIME;
-        textHash = (256*textHash + text[i])%PRIME;
+        patternHash = (256*patternHash + pattern[i])%mod;
+        textHash = (256*textHash + text[i])%mod;
     }
+    if(patternHash<0) patternHash+=mod;
+    if(textHash<0) textHash+=mod;
 
     for(int i=0;i<=n-m;i++){
-        if(patternHash == textHash && text.substr(i,m) == pattern) positions.push_back(i);
-        if(i<n-m) textHash = (256*(textHash - text[i]*h) + text[i+m])%PRIME;
-        if(textHash<0) textHash+=PRIME;
+        if(patternHash == textHash){
+            if(hashHits) (*hashHits)++;
+            if(text.substr(i,m) == pattern) positions.push_back(i);
+        }
+        if(i<n-m) textHash = (256*(textHash - text[i]*h) + text[i+m])%mod;
+        if(textHash<0) textHash+=mod;
     }
     return positions;
 }
 
+/*************************************************************
+ * 1b. RABIN-KARP ENGINE
+ * 64-bit rolling hash mod 2^61-1, all patterns of one length
+ * matched in a single pass through a fingerprint table
+ *************************************************************/
+class RabinKarpEngine{
+public:
+    static constexpr uint64_t MOD=(1ULL<<61)-1;
+    uint64_t base;
+    vector<string> patterns;
+    // Fingerprint hits, and how many of them matched at least one pattern
+    long long candidates=0, verified=0;
+
+    RabinKarpEngine(const vector<string> &pats): patterns(pats){
+        mt19937_64 rng(random_device{}());
+        base = rng()%(MOD-512)+256;
+        map<int,vector<int>> byLen;
+        for(size_t i=0;i<patterns.size();i++) if(!patterns[i].empty()) byLen[patterns[i].size()].push_back(i);
+        for(auto &p: byLen) groups.push_back(buildGroup(p.first,p.second));
+    }
+
+    static uint64_t mulMod(uint64_t a,uint64_t b){
+        __uint128_t p=(__uint128_t)a*b;
+        uint64_t r=(uint64_t)(p&MOD)+(uint64_t)(p>>61);
+        return r>=MOD? r-MOD : r;
+    }
+
+    uint64_t fingerprint(const char *s,int m) const{
+        uint64_t h=0;
+        for(int i=0;i<m;i++){
+            h=mulMod(h,base)+(unsigned char)s[i]+1;
+            if(h>=MOD) h-=MOD;
+        }
+        return h;
+    }
+
+    // positions[i] receives every occurrence of patterns[i] in text
+    vector<vector<int>> search(const string &text){
+        vector<vector<int>> positions(patterns.size());
+        int n=text.size();
+        const char *t=text.data();
+        for(auto &g: groups){
+            int m=g.len;
+            if(n<m) continue;
+            const uint64_t b=base, mask=g.mask, *out=g.outTab.data(), *key=g.slotKey.data();
+            const int *slot=g.slotId.data();
+            uint64_t h=fingerprint(t,m);
+            for(int i=0;;i++){
+                uint64_t s=(h*0x9E3779B97F4A7C15ULL>>20)&mask;
+                for(;slot[s]>=0;s=(s+1)&mask){
+                    if(key[s]!=h) continue;
+                    candidates++;
+                    bool match=false;
+                    for(int id=slot[s]; id>=0; id=g.nextId[id]){
+                        if(memcmp(t+i,patterns[g.ids[id]].data(),m)==0){
+                            match=true;
+                            positions[g.ids[id]].push_back(i);
+                        }
+                    }
+                    verified+=match;
+                    break;
+                }
+                if(i==n-m) break;
+                uint64_t x=h+MOD-out[(unsigned char)t[i]];
+                if(x>=MOD) x-=MOD;
+                h=mulMod(x,b)+(unsigned char)t[i+m]+1;
+                if(h>=MOD) h-=MOD;
+            }
+        }
+        return positions;
+    }
+
+private:
+    struct Group{
+        int len;
+        uint64_t pow, mask;
+        vector<int> ids;
+        vector<uint64_t> slotKey, outTab;
+        vector<int> slotId, nextId;
+        int find(uint64_t h) const{
+            for(uint64_t s=(h*0x9E3779B97F4A7C15ULL>>20)&mask;;s=(s+1)&mask){
+                if(slotId[s]<0) return -1;
+                if(slotKey[s]==h) return s;
+            }
+        }
+    };
+    vector<Group> groups;
+
+    Group buildGroup(int m,const vector<int> &ids){
+        Group g;
+        g.len=m; g.pow=1; g.ids=ids;
+        for(int i=0;i<m-1;i++) g.pow=mulMod(g.pow,base);
+        g.outTab.resize(256);
+        for(int c=0;c<256;c++) g.outTab[c]=mulMod(c+1,g.pow);
+        uint64_t cap=4;
+        while(cap<8*ids.size()) cap<<=1;
+        g.mask=cap-1;
+        g.slotKey.assign(cap,0); g.slotId.assign(cap,-1); g.nextId.assign(ids.size(),-1);
+        for(size_t i=0;i<ids.size();i++){
+            uint64_t h=fingerprint(patterns[ids[i]].data(),m);
+            int s=g.find(h);
+            if(s>=0){ g.nextId[i]=g.slotId[s]; g.slotId[s]=i; continue; }
+            s=(h*0x9E3779B97F4A7C15ULL>>20)&g.mask;
+            while(g.slotId[s]>=0) s=(s+1)&g.mask;
+            g.slotKey[s]=h; g.slotId[s]=i;
+        }
+        return g;
+    }
+};
+
 /*************************************************************
  * 2. TRIE
  *************************************************************/
@@ -63,43 +181,527 @@ public:
     }
 };
 
+/*************************************************************
+ * 2b. ADAPTIVE RADIX TREE
+ * Node4/16/48/256 with path compression. All nodes live in a
+ * bump arena that is released in one shot with the tree.
+ *************************************************************/
+class Arena{
+public:
+    Arena(){}
+    Arena(const Arena&)=delete;
+    Arena& operator=(const Arena&)=delete;
+    ~Arena(){ for(void *b: blocks) ::operator delete(b); }
+    void* allocate(size_t n, size_t align=alignof(max_align_t)){
+        size_t off=(used+align-1)&~(align-1);
+        if(blocks.empty() || off+n>cap){
+            cap=max(BLOCK,n);
+            blocks.push_back(::operator new(cap));
+            total+=cap; off=0;
+        }
+        used=off+n;
+        return (char*)blocks.back()+off;
+    }
+    template<class T> T* make(){ return new(allocate(sizeof(T),alignof(T))) T(); }
+    size_t bytes() const{ return total; }
+private:
+    static constexpr size_t BLOCK=1<<16;
+    vector<void*> blocks;
+    size_t used=0, cap=0, total=0;
+};
+
+class ArtTrie{
+public:
+    ArtTrie(){ root=arena.make<Node4>(); }
+
+    void insert(const string &word){
+        Node **ref=&root;
+        Node *node=root;
+        size_t depth=0, n=word.size();
+        while(true){
+            uint32_t p=0;
+            while(p<node->prefixLen && depth+p<n && node->prefix[p]==word[depth+p]) p++;
+            if(p<node->prefixLen){
+                Node4 *split=arena.make<Node4>();
+                split->prefix=node->prefix; split->prefixLen=p;
+                unsigned char edge=node->prefix[p];
+                node->prefix+=p+1; node->prefixLen-=p+1;
+                addChild(split,edge,node);
+                if(depth+p==n) split->isEnd=true;
+                else addChild(split,word[depth+p],makeLeaf(word,depth+p+1));
+                *ref=split;
+                return;
+            }
+            depth+=node->prefixLen;
+            if(depth==n){ node->isEnd=true; return; }
+            Node **child=findChild(node,word[depth]);
+            if(!child){
+                Node *leaf=makeLeaf(word,depth+1);
+                if(isFull(node)){ node=grow(node); *ref=node; }
+                addChild(node,word[depth],leaf);
+                return;
+            }
+            ref=child; node=*child; depth++;
+        }
+    }
+
+    bool search(const string &word) const{
+        size_t used;
+        const Node *node=find(word,&used);
+        return node && node->isEnd && used+node->prefixLen==word.size();
+    }
+
+    vector<string> autocomplete(const string &prefix) const{
+        vector<string> results;
+        size_t used;
+        const Node *node=find(prefix,&used);
+        if(!node) return results;
+        string buf(prefix.begin(),prefix.begin()+used);
+        buf.append(node->prefix,node->prefixLen);
+        collect(node,buf,results);
+        return results;
+    }
+
+    size_t bytes() const{ return arena.bytes(); }
+
+private:
+    enum { N4, N16, N48, N256 };
+    struct Node{
+        uint8_t type;
+        uint16_t count=0;
+        bool isEnd=false;
+        uint32_t prefixLen=0;
+        const char *prefix=nullptr;
+        Node(uint8_t t): type(t){}
+    };
+    struct Node4: Node{ unsigned char key[4]; Node *child[4]; Node4(): Node(N4){} };
+    struct Node16: Node{ unsigned char key[16]; Node *child[16]; Node16(): Node(N16){} };
+    struct Node48: Node{ uint8_t index[256]; Node *child[48]; Node48(): Node(N48){ memset(index,0xff,sizeof(index)); } };
+    struct Node256: Node{ Node *child[256]; Node256(): Node(N256){ memset(child,0,sizeof(child)); } };
+
+    Arena arena;
+    Node *root;
+
+    Node* makeLeaf(const string &word, size_t from){
+        Node4 *leaf=arena.make<Node4>();
+        leaf->prefixLen=word.size()-from;
+        char *p=(char*)arena.allocate(leaf->prefixLen,1);
+        memcpy(p,word.data()+from,leaf->prefixLen);
+        leaf->prefix=p;
+        leaf->isEnd=true;
+        return leaf;
+    }
+
+    static bool isFull(const Node *n){
+        return (n->type==N4 && n->count==4) || (n->type==N16 && n->count==16) || (n->type==N48 && n->count==48);
+    }
+
+    static Node** findChild(Node *n, unsigned char c){
+        switch(n->type){
+        case N4:{
+            Node4 *x=(Node4*)n;
+            for(int i=0;i<x->count;i++) if(x->key[i]==c) return &x->child[i];
+            return nullptr;
+        }
+        case N16:{
+            Node16 *x=(Node16*)n;
+#ifdef __SSE2__
+            int mask=_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(c),_mm_loadu_si128((const __m128i*)x->key)))&((1<<x->count)-1);
+            return mask? &x->child[__builtin_ctz(mask)] : nullptr;
+#else
+            for(int i=0;i<x->count;i++) if(x->key[i]==c) return &x->child[i];
+            return nullptr;
+#endif
+        }
+        case N48:{
+            Node48 *x=(Node48*)n;
+            return x->index[c]==0xff? nullptr : &x->child[x->index[c]];
+        }
+        default:{
+            Node256 *x=(Node256*)n;
+            return x->child[c]? &x->child[c] : nullptr;
+        }
+        }
+    }
+
+    // Keys of Node4/16 stay sorted so traversal is in lexicographic order
+    static void addChild(Node *n, unsigned char c, Node *child){
+        if(n->type==N4 || n->type==N16){
+            unsigned char *key= n->type==N4? ((Node4*)n)->key : ((Node16*)n)->key;
+            Node **ch= n->type==N4? ((Node4*)n)->child : ((Node16*)n)->child;
+            int i=n->count;
+            while(i>0 && key[i-1]>c){ key[i]=key[i-1]; ch[i]=ch[i-1]; i--; }
+            key[i]=c; ch[i]=child;
+        } else if(n->type==N48){
+            Node48 *x=(Node48*)n;
+            x->index[c]=x->count; x->child[x->count]=child;
+        } else ((Node256*)n)->child[c]=child;
+        n->count++;
+    }
+
+    Node* grow(Node *n){
+        Node *big;
+        if(n->type==N4){
+            Node16 *x=arena.make<Node16>();
+            memcpy(x->key,((Node4*)n)->key,4); memcpy(x->child,((Node4*)n)->child,4*sizeof(Node*));
+            big=x;
+        } else if(n->type==N16){
+            Node16 *o=(Node16*)n;
+            Node48 *x=arena.make<Node48>();
+            for(int i=0;i<16;i++){ x->index[o->key[i]]=i; x->child[i]=o->child[i]; }
+            big=x;
+        } else{
+            Node48 *o=(Node48*)n;
+            Node256 *x=arena.make<Node256>();
+            for(int c=0;c<256;c++) if(o->index[c]!=0xff) x->child[c]=o->child[o->index[c]];
+            big=x;
+        }
+        big->count=n->count; big->isEnd=n->isEnd;
+        big->prefix=n->prefix; big->prefixLen=n->prefixLen;
+        return big;
+    }
+
+    // Node whose compressed prefix holds the end of key; *used gets the
+    // key bytes consumed before that prefix
+    const Node* find(const string &key, size_t *used) const{
+        Node *node=root;
+        size_t depth=0, n=key.size();
+        while(true){
+            uint32_t p=0;
+            while(p<node->prefixLen && depth+p<n && node->prefix[p]==key[depth+p]) p++;
+            if(depth+p==n){ *used=depth; return node; }
+            if(p<node->prefixLen) return nullptr;
+            depth+=p;
+            Node **child=findChild(node,key[depth]);
+            if(!child) return nullptr;
+            node=*child; depth++;
+        }
+    }
+
+    static void collect(const Node *n, string &buf, vector<string> &out){
+        if(n->isEnd) out.push_back(buf);
+        auto visit=[&](unsigned char c,const Node *child){
+            size_t len=buf.size();
+            buf.push_back(c);
+            buf.append(child->prefix,child->prefixLen);
+            collect(child,buf,out);
+            buf.resize(len);
+        };
+        switch(n->type){
+        case N4:{ const Node4 *x=(const Node4*)n; for(int i=0;i<x->count;i++) visit(x->key[i],x->child[i]); break; }
+        case N16:{ const Node16 *x=(const Node16*)n; for(int i=0;i<x->count;i++) visit(x->key[i],x->child[i]); break; }
+        case N48:{ const Node48 *x=(const Node48*)n; for(int c=0;c<256;c++) if(x->index[c]!=0xff) visit(c,x->child[x->index[c]]); break; }
+        default:{ const Node256 *x=(const Node256*)n; for(int c=0;c<256;c++) if(x->child[c]) visit(c,x->child[c]); }
+        }
+    }
+};
+
+/*************************************************************
+ * 2c. TOP-K WEIGHTED AUTOCOMPLETE
+ * Path-compressed trie over the sorted keys; every node caches
+ * its k heaviest completions, so a query costs O(prefix + k)
+ *************************************************************/
+class TopKCompleter{
+public:
+    int K;
+
+    TopKCompleter(int k=10): K(min(k,255)){}
+
+    // Repeated keys have their weights summed
+    void build(vector<pair<string,uint64_t>> entries){
+        sort(entries.begin(),entries.end());
+        pool.clear(); offsets.assign(1,0); weights.clear();
+        for(size_t i=0;i<entries.size();i++){
+            if(i && entries[i].first==entries[i-1].first){ weights.back()+=entries[i].second; continue; }
+            pool+=entries[i].first;
+            offsets.push_back(pool.size());
+            weights.push_back(entries[i].second);
+        }
+        nodes.assign(1,Node());
+        top.clear();
+        if(!weights.empty()) buildNode(0,0,weights.size(),0);
+    }
+
+    // Writes up to min(K, cap) completions of prefix, heaviest first, into out
+    size_t complete(string_view prefix, string_view *out, size_t cap, uint64_t *outWeights=nullptr) const{
+        if(weights.empty()) return 0;
+        uint32_t v=0, checked=0;
+        while(true){
+            const Node &nd=nodes[v];
+            string_view path=key(nd.lo).substr(0,nd.depth);
+            uint32_t upto=min<size_t>(prefix.size(),nd.depth);
+            if(path.compare(checked,upto-checked,prefix,checked,upto-checked)!=0) return 0;
+            checked=upto;
+            if(prefix.size()<=nd.depth) break;
+            unsigned char c=prefix[nd.depth];
+            uint32_t lo=nd.firstChild, hi=nd.firstChild+nd.childCount;
+            while(lo<hi){
+                uint32_t mid=(lo+hi)/2;
+                if((unsigned char)key(nodes[mid].lo)[nd.depth]<c) lo=mid+1; else hi=mid;
+            }
+            if(lo==nd.firstChild+nd.childCount || (unsigned char)key(nodes[lo].lo)[nd.depth]!=c) return 0;
+            v=lo;
+        }
+        const Node &nd=nodes[v];
+        size_t n=min<size_t>(nd.topCount,cap);
+        for(size_t i=0;i<n;i++){
+            out[i]=key(top[nd.topStart+i]);
+            if(outWeights) outWeights[i]=weights[top[nd.topStart+i]];
+        }
+        return n;
+    }
+
+    size_t bytes() const{
+        return pool.capacity()+offsets.capacity()*sizeof(uint64_t)+weights.capacity()*sizeof(uint64_t)
+              +nodes.capacity()*sizeof(Node)+top.capacity()*sizeof(uint32_t);
+    }
+
+private:
+    struct Node{
+        uint32_t lo=0, depth=0, firstChild=0, topStart=0;
+        uint16_t childCount=0;
+        uint8_t topCount=0;
+    };
+    string pool;
+    vector<uint64_t> offsets, weights;
+    vector<Node> nodes;
+    vector<uint32_t> top;
+
+    string_view key(uint32_t i) const{ return string_view(pool.data()+offsets[i],offsets[i+1]-offsets[i]); }
+
+    // Node v covers sorted keys [lo,hi); its label ends where keys lo and hi-1 diverge
+    void buildNode(uint32_t v,uint32_t lo,uint32_t hi,uint32_t depth){
+        string_view a=key(lo), b=key(hi-1);
+        while(depth<a.size() && depth<b.size() && a[depth]==b[depth]) depth++;
+        nodes[v].lo=lo; nodes[v].depth=depth;
+        vector<uint32_t> cand;
+        uint32_t first=lo;
+        if(a.size()==depth){ cand.push_back(lo); first++; }
+        vector<uint32_t> bounds;
+        for(uint32_t i=first;i<hi;i++)
+            if(i==first || key(i)[depth]!=key(i-1)[depth]) bounds.push_back(i);
+        bounds.push_back(hi);
+        uint32_t firstChild=nodes.size(), count=bounds.size()-1;
+        nodes[v].firstChild=firstChild; nodes[v].childCount=count;
+        nodes.resize(nodes.size()+count);
+        for(uint32_t j=0;j<count;j++){
+            buildNode(firstChild+j,bounds[j],bounds[j+1],depth+1);
+            const Node &ch=nodes[firstChild+j];
+            cand.insert(cand.end(),top.begin()+ch.topStart,top.begin()+ch.topStart+ch.topCount);
+        }
+        size_t k=min<size_t>(K,cand.size());
+        partial_sort(cand.begin(),cand.begin()+k,cand.end(),[&](uint32_t x,uint32_t y){
+            return weights[x]!=weights[y]? weights[x]>weights[y] : x<y;
+        });
+        nodes[v].topStart=top.size(); nodes[v].topCount=k;
+        top.insert(top.end(),cand.begin(),cand.begin()+k);
+    }
+};
+
 /*************************************************************
  * 3. FENWICK TREE
+ * 1-based; built in O(n) by pushing each node into its parent.
+ * Batches larger than about n/log n are folded into one dense
+ * delta array and merged with the same linear pass.
  *************************************************************/
+template<class T>
+void fenwickBuild(vector<T> &bit){
+    size_t n=bit.size()-1;
+    for(size_t i=1;i<=n;i++){
+        size_t j=i+(i&-i);
+        if(j<=n) bit[j]+=bit[i];
+    }
+}
+
+inline bool preferDenseBatch(size_t k, size_t n){
+    size_t lg=1;
+    while((size_t(1)<<lg)<n) lg++;
+    return k*lg>n;
+}
+
+template<class T=int>
 class FenwickTree{
 public:
-    vector<int> BIT;
+    vector<T> BIT;
     int n;
     FenwickTree(int size){ n=size; BIT.assign(n+1,0);}
-    void update(int idx,int val){ for(;idx<=n;idx+=idx&-idx) BIT[idx]+=val; }
-    int query(int idx){ int sum=0; for(;idx>0;idx-=idx&-idx) sum+=BIT[idx]; return sum; }
-    int rangeQuery(int l,int r){ return query(r)-query(l-1); }
+    FenwickTree(const vector<T> &values){
+        n=values.size();
+        BIT.assign(n+1,0);
+        copy(values.begin(),values.end(),BIT.begin()+1);
+        fenwickBuild(BIT);
+    }
+    void update(int idx,T val){ for(;idx<=n;idx+=idx&-idx) BIT[idx]+=val; }
+    T query(int idx) const{ T sum=0; for(;idx>0;idx-=idx&-idx) sum+=BIT[idx]; return sum; }
+    T rangeQuery(int l,int r) const{ return query(r)-query(l-1); }
+
+    // (index, delta) pairs; same result as calling update() for each
+    void applyBatch(const vector<pair<int,T>> &updates){
+        if(!preferDenseBatch(updates.size(),n)){
+            for(auto &u: updates) update(u.first,u.second);
+            return;
+        }
+        vector<T> delta(n+1,0);
+        for(auto &u: updates) delta[u.first]+=u.second;
+        fenwickBuild(delta);
+        for(int i=1;i<=n;i++) BIT[i]+=delta[i];
+    }
+};
+
+// Range add + range sum: prefix(i) = i*sum(B1,i) - sum(B2,i)
+template<class T=int>
+class RangeFenwick{
+public:
+    int n;
+    RangeFenwick(int size): n(size), B1(size), B2(size){}
+    RangeFenwick(const vector<T> &values): n(values.size()), B1(values.size()), B2(negated(values)){}
+
+    void rangeAdd(int l,int r,T v){
+        B1.update(l,v); B1.update(r+1,-v);
+        B2.update(l,v*(l-1)); B2.update(r+1,-v*r);
+    }
+    T prefixSum(int i) const{ return B1.query(i)*i-B2.query(i); }
+    T rangeSum(int l,int r) const{ return prefixSum(r)-prefixSum(l-1); }
+
+    // (l, r, delta) triples
+    void applyBatch(const vector<tuple<int,int,T>> &updates){
+        vector<pair<int,T>> d1, d2;
+        d1.reserve(2*updates.size()); d2.reserve(2*updates.size());
+        for(auto &[l,r,v]: updates){
+            d1.push_back({l,v}); d2.push_back({l,v*(l-1)});
+            if(r<n){ d1.push_back({r+1,-v}); d2.push_back({r+1,-v*r}); }
+        }
+        B1.applyBatch(d1); B2.applyBatch(d2);
+    }
+
+private:
+    FenwickTree<T> B1, B2;
+    static vector<T> negated(vector<T> v){ for(auto &x: v) x=-x; return v; }
+};
+
+// Row-major (rows+1) x (cols+1) grid, both coordinates 1-based
+template<class T=int>
+class Fenwick2D{
+public:
+    int rows, cols;
+    Fenwick2D(int r,int c): rows(r), cols(c), bit((size_t)(r+1)*(c+1),0){}
+    Fenwick2D(const vector<vector<T>> &grid): Fenwick2D(grid.size(),grid.empty()?0:grid[0].size()){
+        for(int i=1;i<=rows;i++) copy(grid[i-1].begin(),grid[i-1].end(),&at(i,1));
+        for(int i=1;i<=rows;i++)
+            for(int j=1;j<=cols;j++){
+                int k=j+(j&-j);
+                if(k<=cols) at(i,k)+=at(i,j);
+            }
+        for(int i=1;i<=rows;i++){
+            int k=i+(i&-i);
+            if(k>rows) continue;
+            T *src=&at(i,0), *dst=&at(k,0);
+            for(int j=1;j<=cols;j++) dst[j]+=src[j];
+        }
+    }
+    void update(int x,int y,T v){
+        for(int i=x;i<=rows;i+=i&-i)
+            for(int j=y;j<=cols;j+=j&-j) at(i,j)+=v;
+    }
+    T query(int x,int y) const{
+        T sum=0;
+        for(int i=x;i>0;i-=i&-i)
+            for(int j=y;j>0;j-=j&-j) sum+=bit[(size_t)i*(cols+1)+j];
+        return sum;
+    }
+    T rangeQuery(int x1,int y1,int x2,int y2) const{
+        return query(x2,y2)-query(x1-1,y2)-query(x2,y1-1)+query(x1-1,y1-1);
+    }
+
+private:
+    vector<T> bit;
+    T& at(int i,int j){ return bit[(size_t)i*(cols+1)+j]; }
 };
 
 /*************************************************************
  * 4. SPARSE TABLE / ARRAY QUERIES
+ * Level-major flat table: level j holds min over [i, i+2^j)
+ * at table[j*n+i], so both probes of a query hit one array.
  *************************************************************/
+inline int floorLog2(uint64_t x){ return 63-__builtin_clzll(x); }
+
+template<class T=int>
 class SparseTable{
 public:
-    vector<vector<int>> st;
-    vector<int> log;
-    int n;
-    SparseTable(const vector<int> &arr){
-        n=arr.size();
-        log.assign(n+1,0);
-        for(int i=2;i<=n;i++) log[i]=log[i/2]+1;
-        int K=log[n]+1;
-        st.assign(n,vector<int>(K));
-        for(int i=0;i<n;i++) st[i][0]=arr[i];
+    vector<T> table;
+    int n, K;
+    SparseTable(): n(0), K(0){}
+    SparseTable(const vector<T> &arr): SparseTable(arr.data(),arr.size()){}
+    SparseTable(const T *arr,int size){
+        n=size;
+        K=n? floorLog2(n)+1 : 0;
+        table.resize((size_t)K*n);
+        copy(arr,arr+n,table.begin());
         for(int j=1;j<K;j++){
-            for(int i=0;i+(1<<j)<=n;i++){
-                st[i][j]=min(st[i][j-1],st[i+(1<<(j-1))][j-1]);
+            const T *prev=&table[(size_t)(j-1)*n];
+            T *cur=&table[(size_t)j*n];
+            int half=1<<(j-1);
+            for(int i=0;i+(1<<j)<=n;i++) cur[i]=min(prev[i],prev[i+half]);
+        }
+    }
+    T queryMin(int l,int r) const{
+        int j=floorLog2(r-l+1);
+        const T *row=&table[(size_t)j*n];
+        return min(row[l],row[r-(1<<j)+1]);
+    }
+    size_t bytes() const{ return table.size()*sizeof(T); }
+};
+
+/*************************************************************
+ * 4b. BLOCK-DECOMPOSED RMQ
+ * Blocks of 64: a sparse table over block minima answers the
+ * middle part; inside a block, mask[i] marks the positions that
+ * are strict suffix minima of block[start..i], so the lowest
+ * marked position >= l is the minimum of [l, i]. The ends of a
+ * cross-block query are in-block queries too. The values are
+ * read from the caller's array, which must outlive the index:
+ * one 64-bit mask per sample plus the block table, O(1) query.
+ *************************************************************/
+template<class T=int>
+class BlockRMQ{
+public:
+    static constexpr int B=64;
+
+    BlockRMQ(const vector<T> &arr): BlockRMQ(arr.data(),arr.size()){}
+    BlockRMQ(vector<T> &&)=delete;
+    BlockRMQ(const T *arr,size_t size): vals(arr), n(size), mask(size){
+        vector<T> blockMin((n+B-1)/B);
+        for(size_t b=0;b<blockMin.size();b++){
+            size_t start=b*B, end=min(n,start+B);
+            uint64_t stack=0;
+            for(size_t i=start;i<end;i++){
+                while(stack && vals[start+floorLog2(stack)]>=vals[i]) stack&=~(1ULL<<floorLog2(stack));
+                stack|=1ULL<<(i-start);
+                mask[i]=stack;
             }
+            blockMin[b]=vals[start+__builtin_ctzll(mask[end-1])];
         }
+        blocks=SparseTable<T>(blockMin);
     }
-    int queryMin(int l,int r){
-        int j=log[r-l+1];
-        return min(st[l][j],st[r-(1<<j)+1][j]);
+
+    T queryMin(size_t l,size_t r) const{
+        size_t bl=l/B, br=r/B;
+        if(bl==br) return inBlock(l,r);
+        T best=min(inBlock(l,bl*B+B-1),inBlock(br*B,r));
+        if(bl+1<br) best=min(best,blocks.queryMin(bl+1,br-1));
+        return best;
+    }
+
+    size_t bytes() const{ return mask.size()*sizeof(uint64_t)+blocks.bytes(); }
+
+private:
+    const T *vals;
+    size_t n;
+    vector<uint64_t> mask;
+    SparseTable<T> blocks;
+
+    T inBlock(size_t l,size_t r) const{
+        return vals[l+__builtin_ctzll(mask[r]>>(l%B))];
     }
 };
 
@@ -148,10 +750,13 @@ vector<vector<int>> buildWordGraph(const vector<string> &words){
  *************************************************************/
 void reportRabinKarp(const vector<string> &docs, const vector<string> &patterns){
     cout<<"\n--- Rabin-Karp Search ---\n";
-    for(auto &p: patterns){
-        cout<<"Pattern '"<<p<<"' positions:\n";
+    RabinKarpEngine rk(patterns);
+    vector<vector<vector<int>>> hits;
+    for(auto &d: docs) hits.push_back(rk.search(d));
+    for(int k=0;k<patterns.size();k++){
+        cout<<"Pattern '"<<patterns[k]<<"' positions:\n";
         for(int i=0;i<docs.size();i++){
-            vector<int> pos=rabinKarpSearch(docs[i],p);
+            vector<int> &pos=hits[i][k];
             cout<<"Doc "<<i+1<<": ";
             if(pos.empty()) cout<<"None";
             else for(int x: pos) cout<<"["<<x<<"] ";
@@ -160,21 +765,39 @@ void reportRabinKarp(const vector<string> &docs, const vector<string> &patterns)
     }
 }
 
-void reportTrie(Trie &trie,const string &prefix){
+void reportTrie(ArtTrie &trie,const string &prefix){
     cout<<"\n--- Trie Autocomplete for '"<<prefix<<"' ---\n";
     vector<string> res=trie.autocomplete(prefix);
     if(res.empty()) cout<<"No suggestions\n";
     else for(auto &s: res) cout<<s<<" "; cout<<endl;
 }
 
-void reportFenwick(FenwickTree &ft,int l,int r){
+void reportTopK(const TopKCompleter &tc,const string &prefix){
+    string_view out[10];
+    uint64_t freq[10];
+    size_t n=tc.complete(prefix,out,10,freq);
+    cout<<"\n--- Top "<<tc.K<<" completions for '"<<prefix<<"' ---\n";
+    if(n==0) cout<<"No suggestions";
+    for(size_t i=0;i<n;i++) cout<<out[i]<<"("<<freq[i]<<") ";
+    cout<<endl;
+}
+
+void reportFenwick(FenwickTree<int> &ft,int l,int r){
     cout<<"\nFenwick Tree: Sum of word lengths "<<l<<"-"<<r<<": "<<ft.rangeQuery(l,r)<<endl;
 }
 
-void reportSparseTable(SparseTable &st,int l,int r){
+void reportRangeFenwick(RangeFenwick<int> &rf,int l,int r){
+    cout<<"Range Fenwick: Sum of word lengths "<<l<<"-"<<r<<" after range add: "<<rf.rangeSum(l,r)<<endl;
+}
+
+void reportSparseTable(SparseTable<int> &st,int l,int r){
     cout<<"\nSparse Table: Min word length "<<l<<"-"<<r<<": "<<st.queryMin(l,r)<<endl;
 }
 
+void reportBlockRMQ(BlockRMQ<int> &rmq,int l,int r){
+    cout<<"Block RMQ: Min word length "<<l<<"-"<<r<<": "<<rmq.queryMin(l,r)<<endl;
+}
+
 void reportGraph(vector<vector<int>> &adj){
     cout<<"\nDFS Traversal: ";
     vector<bool> visited(adj.size(),false);
@@ -182,10 +805,285 @@ void reportGraph(vector<vector<int>> &adj){
     BFS(0,adj);
 }
 
+/*************************************************************
+ * BENCHMARKS (run with: ./Case8 bench <name> [size])
+ *************************************************************/
+double secondsSince(chrono::steady_clock::time_point t0){
+    return chrono::duration<double>(chrono::steady_clock::now()-t0).count();
+}
+
+string randomText(size_t n, int alphabet){
+    mt19937 rng(42);
+    string s(n,' ');
+    for(auto &c: s) c='a'+rng()%alphabet;
+    return s;
+}
+
+void benchRabinKarp(size_t mb){
+    cout<<"\n--- Rabin-Karp benchmark ("<<mb<<" MB, alphabet 4) ---\n";
+    string text=randomText(mb<<20,4);
+    mt19937 rng(7);
+    for(int m: {8,16,32}){
+        string pat=text.substr(rng()%(text.size()-m),m);
+        for(long long mod: {(long long)PRIME,1000000007LL}){
+            long long hits=0;
+            auto t0=chrono::steady_clock::now();
+            vector<int> pos=rabinKarpSearch(text,pat,mod,&hits);
+            double sec=secondsSince(t0);
+            cout<<"mod "<<mod<<" m="<<m<<": "<<mb/sec<<" MB/s, hash hits "<<hits<<", matches "<<pos.size()
+                <<", false-positive rate "<<(double)(hits-pos.size())/(text.size()-m+1)<<endl;
+        }
+        RabinKarpEngine rk({pat});
+        auto t0=chrono::steady_clock::now();
+        vector<vector<int>> pos=rk.search(text);
+        double sec=secondsSince(t0);
+        cout<<"mod 2^61-1 m="<<m<<": "<<mb/sec<<" MB/s, hash hits "<<rk.candidates<<", matches "<<pos[0].size()
+            <<", false-positive rate "<<(double)(rk.candidates-rk.verified)/(text.size()-m+1)<<endl;
+    }
+    for(int k: {10,100,1000}){
+        vector<string> pats;
+        for(int i=0;i<k;i++) pats.push_back(text.substr(rng()%(text.size()-12),12));
+        RabinKarpEngine rk(pats);
+        auto t0=chrono::steady_clock::now();
+        vector<vector<int>> pos=rk.search(text);
+        double sec=secondsSince(t0);
+        long long total=0;
+        for(auto &v: pos) total+=v.size();
+        cout<<k<<" patterns of length 12 in one pass: "<<mb/sec<<" MB/s, matches "<<total
+            <<", candidates "<<rk.candidates<<", verified "<<rk.verified<<endl;
+        if(k>10) continue;
+        t0=chrono::steady_clock::now();
+        total=0;
+        for(auto &p: pats) total+=rabinKarpSearch(text,p,1000000007LL).size();
+        sec=secondsSince(t0);
+        cout<<k<<" separate mod 1e9+7 scans: "<<mb/sec<<" MB/s, matches "<<total<<endl;
+    }
+}
+
+size_t countNodes(TrieNode *n){
+    size_t c=1;
+    for(auto &p: n->children) if(p.second) c+=countNodes(p.second);
+    return c;
+}
+
+vector<string> randomWords(size_t n){
+    vector<string> vocab;
+    mt19937 rng(11);
+    for(size_t i=0;i<n;i++){
+        string w;
+        int len=4+rng()%9;
+        for(int j=0;j<len;j++) w+='a'+rng()%26;
+        vocab.push_back(w);
+    }
+    return vocab;
+}
+
+void benchTrie(size_t n){
+    cout<<"\n--- Trie benchmark ("<<n<<" words) ---\n";
+    vector<string> words=randomWords(n);
+    vector<string> prefixes;
+    for(int i=0;i<100000;i++) prefixes.push_back(words[i%n].substr(0,3));
+    {
+        auto t0=chrono::steady_clock::now();
+        Trie trie;
+        for(auto &w: words) trie.insert(w);
+        double ins=secondsSince(t0);
+        size_t nodes=countNodes(trie.root);
+        t0=chrono::steady_clock::now();
+        size_t total=0;
+        for(int i=0;i<10000;i++) total+=trie.autocomplete(prefixes[i]).size();
+        double ac=secondsSince(t0);
+        cout<<"map Trie: insert "<<ins/n*1e9<<" ns/word, autocomplete "<<ac/10000*1e6<<" us/query ("<<total
+            <<" results), ~"<<nodes*(sizeof(TrieNode)+48)/1048576.0<<" MB in "<<nodes<<" separate allocations"<<endl;
+    }
+    auto t0=chrono::steady_clock::now();
+    ArtTrie *art=new ArtTrie();
+    for(auto &w: words) art->insert(w);
+    double ins=secondsSince(t0);
+    t0=chrono::steady_clock::now();
+    size_t hits=0;
+    for(auto &w: words) hits+=art->search(w);
+    double se=secondsSince(t0);
+    t0=chrono::steady_clock::now();
+    size_t total=0;
+    for(int i=0;i<10000;i++) total+=art->autocomplete(prefixes[i]).size();
+    double ac=secondsSince(t0);
+    size_t bytes=art->bytes();
+    t0=chrono::steady_clock::now();
+    delete art;
+    cout<<"ArtTrie: insert "<<ins/n*1e9<<" ns/word, search "<<se/n*1e9<<" ns ("<<hits<<" hits), autocomplete "
+        <<ac/10000*1e6<<" us/query ("<<total<<" results), "<<bytes/1048576.0<<" MB arena, freed in "
+        <<secondsSince(t0)*1e3<<" ms"<<endl;
+}
+
+void benchTopK(size_t n){
+    cout<<"\n--- Top-10 autocomplete benchmark ("<<n<<" weighted keys) ---\n";
+    vector<string> words=randomWords(n);
+    vector<pair<string,uint64_t>> entries;
+    unordered_map<string,uint64_t> weightOf;
+    for(size_t i=0;i<n;i++){
+        uint64_t w=1000000000/(i+1);
+        entries.push_back({words[i],w});
+        weightOf[words[i]]+=w;
+    }
+    mt19937 rng(5);
+    vector<string> prefixes;
+    for(int i=0;i<20000;i++) prefixes.push_back(words[rng()%n].substr(0,1+rng()%3));
+    auto t0=chrono::steady_clock::now();
+    TopKCompleter tc(10);
+    tc.build(entries);
+    cout<<"TopKCompleter build "<<secondsSince(t0)<<" s, "<<tc.bytes()/1048576.0<<" MB"<<endl;
+    string_view out[10];
+    t0=chrono::steady_clock::now();
+    size_t total=0;
+    for(auto &p: prefixes) total+=tc.complete(p,out,10);
+    cout<<"TopKCompleter: "<<secondsSince(t0)/prefixes.size()*1e6<<" us/query ("<<total<<" results)"<<endl;
+    ArtTrie art;
+    for(auto &w: words) art.insert(w);
+    t0=chrono::steady_clock::now();
+    total=0;
+    int sampled=min<int>(prefixes.size(),500);
+    for(int i=0;i<sampled;i++){
+        vector<string> all=art.autocomplete(prefixes[i]);
+        size_t k=min<size_t>(10,all.size());
+        partial_sort(all.begin(),all.begin()+k,all.end(),[&](const string &a,const string &b){ return weightOf[a]>weightOf[b]; });
+        total+=k;
+    }
+    cout<<"ArtTrie collect-all + partial_sort: "<<secondsSince(t0)/sampled*1e6<<" us/query ("<<total<<" results)"<<endl;
+}
+
+void benchFenwick(size_t n){
+    cout<<"\n--- Fenwick benchmark ("<<n<<" int64 counters, batches of 100k) ---\n";
+    mt19937_64 rng(11);
+    vector<int64_t> values(n);
+    for(auto &v: values) v=rng()%1000;
+    auto t0=chrono::steady_clock::now();
+    FenwickTree<int64_t> slow(n);
+    for(size_t i=0;i<n;i++) slow.update(i+1,values[i]);
+    double perUpdate=secondsSince(t0);
+    t0=chrono::steady_clock::now();
+    FenwickTree<int64_t> fast(values);
+    double linear=secondsSince(t0);
+    cout<<"build: n updates "<<perUpdate<<" s, linear "<<linear<<" s"<<(slow.BIT==fast.BIT? "" : " MISMATCH")<<endl;
+
+    const int batch=100000, rounds=20;
+    for(size_t counters: {n,min<size_t>(n,1<<20)}){
+        FenwickTree<int64_t> a(vector<int64_t>(values.begin(),values.begin()+counters)), b(a);
+        vector<vector<pair<int,int64_t>>> batches(rounds);
+        for(auto &bt: batches)
+            for(int i=0;i<batch;i++) bt.push_back({int(rng()%counters)+1,int64_t(rng()%100)});
+        t0=chrono::steady_clock::now();
+        for(auto &bt: batches) for(auto &u: bt) a.update(u.first,u.second);
+        double one=secondsSince(t0);
+        t0=chrono::steady_clock::now();
+        for(auto &bt: batches) b.applyBatch(bt);
+        double batched=secondsSince(t0);
+        cout<<"point updates on "<<counters<<" counters: one at a time "<<rounds*batch/one/1e6<<" M/s, applyBatch "
+            <<rounds*batch/batched/1e6<<" M/s"<<(a.BIT==b.BIT? "" : " MISMATCH")<<endl;
+    }
+
+    RangeFenwick<int64_t> rf(values);
+    vector<tuple<int,int,int64_t>> ranges;
+    for(int i=0;i<batch;i++){
+        int l=rng()%n+1, r=rng()%n+1;
+        ranges.push_back({min(l,r),max(l,r),int64_t(rng()%100)});
+    }
+    t0=chrono::steady_clock::now();
+    for(auto &[l,r,v]: ranges) rf.rangeAdd(l,r,v);
+    double adds=secondsSince(t0);
+    t0=chrono::steady_clock::now();
+    rf.applyBatch(ranges);
+    double addBatch=secondsSince(t0);
+    int64_t check=0;
+    t0=chrono::steady_clock::now();
+    for(auto &[l,r,v]: ranges) check+=rf.rangeSum(l,r);
+    double sums=secondsSince(t0);
+    cout<<"range add "<<batch/adds/1e6<<" M/s ("<<batch/addBatch/1e6<<" M/s batched), range sum "
+        <<batch/sums/1e6<<" M/s"<<endl;
+
+    int side=2048;
+    vector<vector<int64_t>> grid(side,vector<int64_t>(side));
+    for(auto &row: grid) for(auto &v: row) v=rng()%10;
+    t0=chrono::steady_clock::now();
+    Fenwick2D<int64_t> heat(grid);
+    double build2d=secondsSince(t0);
+    t0=chrono::steady_clock::now();
+    for(int i=0;i<batch;i++){
+        int x1=rng()%side+1, x2=rng()%side+1, y1=rng()%side+1, y2=rng()%side+1;
+        check+=heat.rangeQuery(min(x1,x2),min(y1,y2),max(x1,x2),max(y1,y2));
+    }
+    double q2d=secondsSince(t0);
+    cout<<"2D "<<side<<"x"<<side<<": build "<<build2d*1e3<<" ms, rectangle sum "<<q2d/batch*1e9<<" ns/query"
+        <<" (checksum "<<check<<")"<<endl;
+}
+
+void benchRMQ(size_t n){
+    cout<<"\n--- Range-minimum benchmark ("<<n<<" sensor samples) ---\n";
+    mt19937 rng(13);
+    vector<int> series(n);
+    for(auto &v: series) v=rng()%1000000;
+    const int Q=1000000;
+    vector<pair<int,int>> queries(Q);
+    for(auto &q: queries){
+        int l=rng()%n, r=rng()%n;
+        q={min(l,r),max(l,r)};
+    }
+    auto run=[&](const string &label,double build,size_t bytes,auto query){
+        auto t0=chrono::steady_clock::now();
+        long long check=0;
+        for(auto &q: queries) check+=query(q.first,q.second);
+        double sec=secondsSince(t0);
+        cout<<label<<": build "<<build<<" s, "<<bytes/1048576.0<<" MB, "<<sec/Q*1e9<<" ns/query (checksum "<<check<<")"<<endl;
+    };
+    auto t0=chrono::steady_clock::now();
+    {
+        BlockRMQ<int> rmq(series);
+        run("BlockRMQ",secondsSince(t0),rmq.bytes(),[&](int l,int r){ return rmq.queryMin(l,r); });
+    }
+
+    // The full tables need n log n entries; measure them on a prefix that fits in memory
+    size_t m=min<size_t>(n,1<<22);
+    for(auto &q: queries){
+        int l=rng()%m, r=rng()%m;
+        q={min(l,r),max(l,r)};
+    }
+    cout<<"On the first "<<m<<" samples:"<<endl;
+    t0=chrono::steady_clock::now();
+    BlockRMQ<int> small(series.data(),m);
+    run("BlockRMQ",secondsSince(t0),small.bytes(),[&](int l,int r){ return small.queryMin(l,r); });
+    t0=chrono::steady_clock::now();
+    SparseTable<int> flat(series.data(),m);
+    run("Flat SparseTable",secondsSince(t0),flat.bytes(),[&](int l,int r){ return flat.queryMin(l,r); });
+    {
+        t0=chrono::steady_clock::now();
+        int K=floorLog2(m)+1;
+        vector<vector<int>> st(m,vector<int>(K));
+        for(size_t i=0;i<m;i++) st[i][0]=series[i];
+        for(int j=1;j<K;j++)
+            for(size_t i=0;i+(1<<j)<=m;i++) st[i][j]=min(st[i][j-1],st[i+(1<<(j-1))][j-1]);
+        size_t bytes=m*(sizeof(vector<int>)+K*sizeof(int));
+        run("Row-per-index SparseTable",secondsSince(t0),bytes,[&](int l,int r){
+            int j=floorLog2(r-l+1);
+            return min(st[l][j],st[r-(1<<j)+1][j]);
+        });
+    }
+}
+
 /*************************************************************
  * MAIN PROGRAM
  *************************************************************/
-int main(){
+int main(int argc, char **argv){
+    if(argc>1 && string(argv[1])=="bench"){
+        string name=argc>2? argv[2] : "all";
+        size_t size=argc>3? stoul(argv[3]) : 0;
+        if(name=="rabinkarp" || name=="all") benchRabinKarp(size? size : 64);
+        if(name=="trie" || name=="all") benchTrie(size? size : 1000000);
+        if(name=="topk" || name=="all") benchTopK(size? size : 1000000);
+        if(name=="fenwick" || name=="all") benchFenwick(size? size : 10000000);
+        if(name=="rmq" || name=="all") benchRMQ(size? size : 100000000);
+        return 0;
+    }
+
     cout<<"=== Document Analytics Tool (Rabin-Karp + Trie + Fenwick + Sparse Table + Graph) ===\n";
 
     vector<string> documents={
@@ -196,7 +1094,7 @@ int main(){
     };
 
     vector<string> allWords;
-    Trie trie;
+    ArtTrie trie;
     vector<int> wordLengths;
 
     for(auto &doc: documents){
@@ -213,14 +1111,26 @@ int main(){
     reportTrie(trie,"Tr");
     reportTrie(trie,"F");
 
+    // Weighted autocomplete over word frequencies
+    vector<pair<string,uint64_t>> wordFreq;
+    for(auto &w: allWords) wordFreq.push_back({w,1});
+    TopKCompleter topk(3);
+    topk.build(wordFreq);
+    reportTopK(topk,"");
+    reportTopK(topk,"T");
+
     // Fenwick Tree
-    FenwickTree ft(wordLengths.size());
-    for(int i=0;i<wordLengths.size();i++) ft.update(i+1,wordLengths[i]);
+    FenwickTree<int> ft(wordLengths);
     reportFenwick(ft,2,6);
+    RangeFenwick<int> rf(wordLengths);
+    rf.rangeAdd(1,4,1);
+    reportRangeFenwick(rf,2,6);
 
     // Sparse Table
-    SparseTable st(wordLengths);
+    SparseTable<int> st(wordLengths);
     reportSparseTable(st,1,5);
+    BlockRMQ<int> rmq(wordLengths);
+    reportBlockRMQ(rmq,1,5);
 
     // Graph
     vector<vector<int>> adj=buildWordGraph(allWords);
@@ -44,6 +44,221 @@ int querySegTree(int idx, int l, int r, int ql, int qr) {
            querySegTree(idx*2+1, mid+1, r, ql, qr);
 }
 
+struct AddSum {
+    using T = long long;
+    using F = long long;
+    static T id() { return 0; }
+    static T op(T a, T b) { return a + b; }
+    static F fid() { return 0; }
+    static T apply(F f, T x, int len) { return x + f * len; }
+    static F compose(F f, F g) { return f + g; }
+};
+
+struct AddMax {
+    using T = long long;
+    using F = long long;
+    static T id() { return LLONG_MIN; }
+    static T op(T a, T b) { return max(a, b); }
+    static F fid() { return 0; }
+    static T apply(F f, T x, int) { return x == LLONG_MIN ? x : x + f; }
+    static F compose(F f, F g) { return f + g; }
+};
+
+template<class M>
+struct LazySeg {
+    using T = typename M::T;
+    using F = typename M::F;
+    int n, lg, sz;
+    vector<T> d;
+    vector<F> lz;
+
+    LazySeg(const vector<T> &v) : n(v.size()) {
+        lg = 0;
+        while ((1 << lg) < n) lg++;
+        sz = 1 << lg;
+        d.assign(2*sz, M::id());
+        lz.assign(sz, M::fid());
+        copy(v.begin(), v.end(), d.begin() + sz);
+        for (int i = sz-1; i >= 1; i--) pull(i);
+    }
+
+    int len(int k) const { return sz >> (31 - __builtin_clz(k)); }
+
+    void pull(int k) { d[k] = M::op(d[2*k], d[2*k+1]); }
+
+    void put(int k, F f) {
+        d[k] = M::apply(f, d[k], len(k));
+        if (k < sz) lz[k] = M::compose(f, lz[k]);
+    }
+
+    void push(int k) {
+        if (lz[k] == M::fid()) return;
+        put(2*k, lz[k]);
+        put(2*k+1, lz[k]);
+        lz[k] = M::fid();
+    }
+
+    void set(int p, T x) {
+        p += sz;
+        for (int i = lg; i >= 1; i--) push(p >> i);
+        d[p] = x;
+        for (int i = 1; i <= lg; i++) pull(p >> i);
+    }
+
+    T query(int l, int r) {
+        if (l > r) return M::id();
+        l += sz; r += sz+1;
+        for (int i = lg; i >= 1; i--) {
+            if (((l >> i) << i) != l) push(l >> i);
+            if (((r >> i) << i) != r) push((r-1) >> i);
+        }
+        T sl = M::id(), sr = M::id();
+        while (l < r) {
+            if (l & 1) sl = M::op(sl, d[l++]);
+            if (r & 1) sr = M::op(d[--r], sr);
+            l >>= 1; r >>= 1;
+        }
+        return M::op(sl, sr);
+    }
+
+    void update(int l, int r, F f) {
+        if (l > r) return;
+        l += sz; r += sz+1;
+        for (int i = lg; i >= 1; i--) {
+            if (((l >> i) << i) != l) push(l >> i);
+            if (((r >> i) << i) != r) push((r-1) >> i);
+        }
+        int l2 = l, r2 = r;
+        while (l < r) {
+            if (l & 1) put(l++, f);
+            if (r & 1) put(--r, f);
+            l >>= 1; r >>= 1;
+        }
+        l = l2; r = r2;
+        for (int i = 1; i <= lg; i++) {
+            if (((l >> i) << i) != l) pull(l >> i);
+            if (((r >> i) << i) != r) pull((r-1) >> i);
+        }
+    }
+
+    T all() const { return d[1]; }
+};
+
+struct PersistentSeg {
+    struct PNode {
+        long long sum;
+        int left, right;
+    };
+
+    int n;
+    vector<PNode> pool;
+    vector<int> roots;
+    int base = 0;
+    vector<pair<int,int>> checkpoints;
+
+    PersistentSeg(const vector<int> &data) : n(data.size()) {
+        pool.push_back({0, 0, 0});
+        roots.push_back(build(data, 0, n-1));
+    }
+
+    int newNode(long long sum, int left, int right) {
+        pool.push_back({sum, left, right});
+        return pool.size() - 1;
+    }
+
+    int build(const vector<int> &data, int l, int r) {
+        if (l == r) return newNode(data[l], 0, 0);
+        int mid = (l+r)/2;
+        int a = build(data, l, mid);
+        int b = build(data, mid+1, r);
+        return newNode(pool[a].sum + pool[b].sum, a, b);
+    }
+
+    int change(int node, int l, int r, int pos, long long val, bool add) {
+        if (l == r) return newNode(add ? pool[node].sum + val : val, 0, 0);
+        int mid = (l+r)/2;
+        int a = pool[node].left, b = pool[node].right;
+        if (pos <= mid) a = change(a, l, mid, pos, val, add);
+        else b = change(b, mid+1, r, pos, val, add);
+        return newNode(pool[a].sum + pool[b].sum, a, b);
+    }
+
+    long long sum(int node, int l, int r, int ql, int qr) const {
+        if (qr < l || ql > r || node == 0) return 0;
+        if (ql <= l && r <= qr) return pool[node].sum;
+        int mid = (l+r)/2;
+        return sum(pool[node].left, l, mid, ql, qr) +
+               sum(pool[node].right, mid+1, r, ql, qr);
+    }
+
+    int latest() const { return base + roots.size() - 1; }
+
+    int rootOf(int version) const {
+        if (version >= base && version <= latest()) return roots[version - base];
+        auto it = lower_bound(checkpoints.begin(), checkpoints.end(), make_pair(version, INT_MIN));
+        if (it != checkpoints.end() && it->first == version) return it->second;
+        throw out_of_range("version " + to_string(version) + " is not kept");
+    }
+
+    // Newest kept version <= version, for queries against compacted history
+    int floorVersion(int version) const {
+        if (version >= base) return min(version, latest());
+        auto it = upper_bound(checkpoints.begin(), checkpoints.end(), make_pair(version, INT_MAX));
+        if (it == checkpoints.begin()) throw out_of_range("no kept version at or before " + to_string(version));
+        return prev(it)->first;
+    }
+
+    int update(int version, int pos, long long val) {
+        roots.push_back(change(rootOf(version), 0, n-1, pos, val, false));
+        return latest();
+    }
+
+    int add(int version, int pos, long long delta) {
+        roots.push_back(change(rootOf(version), 0, n-1, pos, delta, true));
+        return latest();
+    }
+
+    long long query(int version, int l, int r) const {
+        return sum(rootOf(version), 0, n-1, l, r);
+    }
+
+    // Drops versions below keepFrom except every stride-th one (none if
+    // stride is 0), then copies the nodes still reachable into a new pool
+    void compact(int keepFrom, int stride = 0) {
+        keepFrom = max(base, min(keepFrom, latest()));
+        vector<pair<int,int>> kept;
+        for (auto &c : checkpoints)
+            if (stride && c.first % stride == 0) kept.push_back(c);
+        for (int v = base; v < keepFrom; v++)
+            if (stride && v % stride == 0) kept.push_back({v, roots[v - base]});
+        roots.erase(roots.begin(), roots.begin() + (keepFrom - base));
+        base = keepFrom;
+        checkpoints = kept;
+
+        vector<int> remap(pool.size(), -1);
+        vector<PNode> fresh;
+        fresh.push_back({0, 0, 0});
+        remap[0] = 0;
+        for (auto &c : checkpoints) c.second = relocate(c.second, remap, fresh);
+        for (int &r : roots) r = relocate(r, remap, fresh);
+        fresh.shrink_to_fit();
+        pool.swap(fresh);
+    }
+
+    int relocate(int x, vector<int> &remap, vector<PNode> &fresh) {
+        if (remap[x] >= 0) return remap[x];
+        int a = relocate(pool[x].left, remap, fresh);
+        int b = relocate(pool[x].right, remap, fresh);
+        fresh.push_back({pool[x].sum, a, b});
+        return remap[x] = fresh.size() - 1;
+    }
+
+    size_t bytes() const {
+        return pool.capacity() * sizeof(PNode) + roots.capacity() * sizeof(int) +
+               checkpoints.capacity() * sizeof(pair<int,int>);
+    }
+};
+
 void bfs(int start) {
     queue<int> q;
     visited.assign(n+1,0);
@@ -210,9 +425,110 @@ vector<int> rabinKarp(string txt, string pat) {
     return res;
 }
 
-int main() {
+double since(chrono::steady_clock::time_point t0) {
+    return chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+}
+
+void benchSegTree(int segs, int ops) {
+    mt19937 rng(1);
+    trafficData.assign(segs, 0);
+    for (int &x : trafficData) x = rng() % 1000;
+    vector<long long> init(trafficData.begin(), trafficData.end());
+    vector<array<int,3>> work(ops);
+    for (auto &w : work) {
+        int l = rng() % segs, r = rng() % segs;
+        w = {min(l,r), max(l,r), (int)(rng() % 100)};
+    }
+    cout << "segment tree " << segs << " road segments " << ops << " ops\n";
+
+    auto t0 = chrono::steady_clock::now();
+    segtree.assign(4*segs, 0);
+    buildSegTree(1, 0, segs-1);
+    long long check1 = 0;
+    for (int i = 0; i < ops; i++) {
+        if (i & 1) check1 += querySegTree(1, 0, segs-1, work[i][0], work[i][1]);
+        else updateSegTree(1, 0, segs-1, work[i][0], work[i][2]);
+    }
+    double rec = since(t0);
+
+    t0 = chrono::steady_clock::now();
+    LazySeg<AddSum> sum(init);
+    long long check2 = 0;
+    for (int i = 0; i < ops; i++) {
+        if (i & 1) check2 += sum.query(work[i][0], work[i][1]);
+        else sum.set(work[i][0], work[i][2]);
+    }
+    double it = since(t0);
+    cout << "point set + range sum: recursive " << ops/rec << " ops/s, iterative " << ops/it << " ops/s"
+         << (check1 == check2 ? "" : " MISMATCH") << "\n";
+
+    LazySeg<AddSum> total(init);
+    LazySeg<AddMax> peak(init);
+    unsigned long long check3 = 0;
+    t0 = chrono::steady_clock::now();
+    for (int i = 0; i < ops; i++) {
+        if (i & 1) check3 += total.query(work[i][0], work[i][1]) + peak.query(work[i][0], work[i][1]);
+        else {
+            total.update(work[i][0], work[i][1], work[i][2]);
+            peak.update(work[i][0], work[i][1], work[i][2]);
+        }
+    }
+    double lazy = since(t0);
+    cout << "range add + range sum/max (lazy): " << ops/lazy << " ops/s\n";
+}
+
+void benchPersistent(int segs, int updates) {
+    mt19937 rng(2);
+    vector<int> init(segs);
+    for (int &x : init) x = rng() % 1000;
+    int window = 100000, stride = 500000;
+    cout << "persistent segment tree " << segs << " segments " << updates << " updates, keep last "
+         << window << " versions + every " << stride << "th\n";
+    auto t0 = chrono::steady_clock::now();
+    PersistentSeg hist(init);
+    double build = since(t0);
+    size_t peak = hist.bytes();
+    double compactTime = 0;
+    t0 = chrono::steady_clock::now();
+    for (int i = 0; i < updates; i++) {
+        hist.add(hist.latest(), rng() % segs, rng() % 10);
+        if (hist.latest() - hist.base >= 2*window) {
+            peak = max(peak, hist.bytes());
+            auto c0 = chrono::steady_clock::now();
+            hist.compact(hist.latest() - window, stride);
+            compactTime += since(c0);
+        }
+    }
+    double upd = since(t0) - compactTime;
+    peak = max(peak, hist.bytes());
+    int q = 1000000;
+    long long check = 0;
+    t0 = chrono::steady_clock::now();
+    for (int i = 0; i < q; i++) {
+        int l = rng() % segs, r = rng() % segs;
+        int v = hist.floorVersion(rng() % (hist.latest() + 1));
+        check += hist.query(v, min(l,r), max(l,r));
+    }
+    double qt = since(t0);
+    cout << "build " << build << " s, update " << upd/updates*1e9 << " ns, compaction total " << compactTime
+         << " s, query " << qt/q*1e9 << " ns\n";
+    cout << "memory peak " << peak/1048576.0 << " MB, now " << hist.bytes()/1048576.0 << " MB, "
+         << hist.roots.size() << " recent + " << hist.checkpoints.size() << " checkpoint versions (checksum "
+         << check << ")\n";
+}
+
+int main(int argc, char **argv) {
     srand(time(NULL));
 
+    if (argc > 2 && string(argv[1]) == "bench" && string(argv[2]) == "seg") {
+        benchSegTree(argc > 3 ? stoi(argv[3]) : 4000000, argc > 4 ? stoi(argv[4]) : 2000000);
+        return 0;
+    }
+    if (argc > 2 && string(argv[1]) == "bench" && string(argv[2]) == "persist") {
+        benchPersistent(argc > 3 ? stoi(argv[3]) : 1000000, argc > 4 ? stoi(argv[4]) : 2000000);
+        return 0;
+    }
+
     n = 8;
     m = 10;
 
@@ -233,8 +549,9 @@ int main() {
     }
 
     trafficData = {5,3,7,2,9,4,6,8};
-    segtree.resize(4*trafficData.size());
-    buildSegTree(1,0,trafficData.size()-1);
+    LazySeg<AddSum> trafficSum(vector<long long>(trafficData.begin(), trafficData.end()));
+    PersistentSeg trafficHistory(trafficData);
+    for (int t = 0; t < 5; t++) trafficHistory.add(trafficHistory.latest(), 2 + t, 10);
 
     bfs(1);
     dfs(1);
@@ -275,7 +592,11 @@ int main() {
     cout << "\n";
 
     cout << "SegmentTreeQuery ";
-    cout << querySegTree(1,0,trafficData.size()-1,2,6) << "\n";
+    cout << trafficSum.query(2,6) << "\n";
+
+    cout << "SegmentTreeHistory ";
+    for (int t = 0; t <= trafficHistory.latest(); t++) cout << trafficHistory.query(t,2,6) << " ";
+    cout << "\n";
 
     return 0;
 }
@@ -6,22 +6,8 @@ struct Node {
     vector<int> neighbors;
 };
 
-struct Huff {
-    char c;
-    int f;
-    Huff *l, *r;
-    Huff(char c,int f):c(c),f(f),l(NULL),r(NULL){}
-};
-
-struct cmp {
-    bool operator()(Huff* a, Huff* b){
-        return a->f > b->f;
-    }
-};
-
 vector<Node> graphNodes;
 vector<int> visited, visited2;
-unordered_map<char,string> codes;
 int dpHaz[205][205];
 
 void dfs(int u){
@@ -61,30 +47,188 @@ int hazard(int d,int x){
     return dpHaz[d][x];
 }
 
-void buildHuff(Huff* r,string s){
-    if(!r) return;
-    if(!r->l && !r->r) codes[r->c]=s;
-    buildHuff(r->l,s+"0");
-    buildHuff(r->r,s+"1");
-}
+const int HUFF_MAX=11;
 
-string huffEncode(string t){
-    unordered_map<char,int>f;
-    for(char c:t) f[c]++;
-    priority_queue<Huff*,vector<Huff*>,cmp> pq;
-    for(auto &p:f) pq.push(new Huff(p.first,p.second));
+struct HuffEntry {
+    uint8_t sym[2];
+    uint8_t n,bits;
+};
+
+void huffLengths(const uint64_t* f,uint8_t* len){
+    vector<pair<uint64_t,int>> heapv;
+    vector<int> parent;
+    vector<int> syms;
+    for(int c=0;c<256;c++){
+        len[c]=0;
+        if(f[c]){
+            heapv.push_back({f[c],syms.size()});
+            syms.push_back(c);
+        }
+    }
+    int m=syms.size();
+    if(m==0) return;
+    if(m==1){ len[syms[0]]=1; return; }
+    parent.assign(2*m-1,-1);
+    priority_queue<pair<uint64_t,int>,vector<pair<uint64_t,int>>,greater<pair<uint64_t,int>>> pq(heapv.begin(),heapv.end());
+    int next=m;
     while(pq.size()>1){
-        Huff* a=pq.top(); pq.pop();
-        Huff* b=pq.top(); pq.pop();
-        Huff* m=new Huff('*',a->f+b->f);
-        m->l=a; m->r=b;
-        pq.push(m);
-    }
-    Huff* root=pq.top();
-    buildHuff(root,"");
-    string s="";
-    for(char c:t) s+=codes[c];
-    return s;
+        auto a=pq.top(); pq.pop();
+        auto b=pq.top(); pq.pop();
+        parent[a.second]=parent[b.second]=next;
+        pq.push({a.first+b.first,next++});
+    }
+    vector<int> depth(2*m-1,0);
+    int bl[2*256]={0},maxLen=0;
+    for(int i=2*m-3;i>=0;i--) depth[i]=depth[parent[i]]+1;
+    for(int i=0;i<m;i++){ bl[depth[i]]++; maxLen=max(maxLen,depth[i]); }
+    for(int i=maxLen;i>HUFF_MAX;i--){
+        while(bl[i]>0){
+            int j=i-2;
+            while(bl[j]==0) j--;
+            bl[i]-=2; bl[i-1]++;
+            bl[j+1]+=2; bl[j]--;
+        }
+    }
+    vector<int> ord(m);
+    iota(ord.begin(),ord.end(),0);
+    stable_sort(ord.begin(),ord.end(),[&](int a,int b){ return f[syms[a]]>f[syms[b]]; });
+    int k=0;
+    for(int l=1;l<=HUFF_MAX;l++)
+        for(int c=0;c<bl[l];c++) len[syms[ord[k++]]]=l;
+}
+
+bool huffCodes(const uint8_t* len,uint32_t* code){
+    int bl[HUFF_MAX+1]={0};
+    for(int c=0;c<256;c++){
+        if(len[c]>HUFF_MAX) return false;
+        if(len[c]) bl[len[c]]++;
+    }
+    uint32_t next[HUFF_MAX+2],cd=0;
+    long long kraft=0;
+    for(int l=1;l<=HUFF_MAX;l++){
+        cd=(cd+bl[l-1])<<1;
+        next[l]=cd;
+        kraft+=(long long)bl[l]<<(HUFF_MAX-l);
+    }
+    if(kraft>(1<<HUFF_MAX)) return false;
+    for(int c=0;c<256;c++) if(len[c]) code[c]=next[len[c]]++;
+    return true;
+}
+
+struct BitWriter {
+    uint8_t* p;
+    uint64_t acc=0;
+    int n=0;
+    BitWriter(uint8_t* p):p(p){}
+    void put(uint32_t code,int len){
+        acc=(acc<<len)|code;
+        n+=len;
+    }
+    void flush32(){
+        if(n<32) return;
+        uint32_t w=__builtin_bswap32((uint32_t)(acc>>(n-32)));
+        memcpy(p,&w,4);
+        p+=4; n-=32;
+    }
+    void finish(){
+        flush32();
+        while(n>0){
+            *p++=n>=8?acc>>(n-8):acc<<(8-n);
+            n-=8;
+        }
+        n=0;
+    }
+};
+
+vector<uint8_t> huffCompress(string_view t){
+    uint64_t f[4][256]={{0}};
+    const uint8_t* s=(const uint8_t*)t.data();
+    size_t n=t.size(),i=0;
+    for(;i+4<=n;i+=4){ f[0][s[i]]++; f[1][s[i+1]]++; f[2][s[i+2]]++; f[3][s[i+3]]++; }
+    for(;i<n;i++) f[0][s[i]]++;
+    for(int c=0;c<256;c++) f[0][c]+=f[1][c]+f[2][c]+f[3][c];
+    uint8_t len[256];
+    uint32_t code[256]={0};
+    huffLengths(f[0],len);
+    huffCodes(len,code);
+    vector<uint8_t> out(4+8+128+n*HUFF_MAX/8+16);
+    memcpy(out.data(),"HUF1",4);
+    uint64_t sz=n;
+    memcpy(out.data()+4,&sz,8);
+    for(int c=0;c<256;c+=2) out[12+c/2]=len[c]|len[c+1]<<4;
+    BitWriter w(out.data()+140);
+    for(i=0;i+2<=n;i+=2){
+        w.put(code[s[i]],len[s[i]]);
+        w.put(code[s[i+1]],len[s[i+1]]);
+        w.flush32();
+    }
+    if(i<n) w.put(code[s[i]],len[s[i]]);
+    w.finish();
+    out.resize(w.p-out.data());
+    return out;
+}
+
+string huffDecompress(const vector<uint8_t>&z){
+    if(z.size()<140 || memcmp(z.data(),"HUF1",4)) throw runtime_error("bad huffman header");
+    uint64_t n;
+    memcpy(&n,z.data()+4,8);
+    uint8_t len[256];
+    uint32_t code[256];
+    for(int c=0;c<256;c+=2){ len[c]=z[12+c/2]&15; len[c+1]=z[12+c/2]>>4; }
+    if(!huffCodes(len,code)) throw runtime_error("bad huffman code lengths");
+    const int T=HUFF_MAX;
+    vector<pair<uint8_t,uint8_t>> one(1<<T,{0,0});
+    for(int c=0;c<256;c++)
+        if(len[c])
+            for(uint32_t k=code[c]<<(T-len[c]);k<(code[c]+1)<<(T-len[c]);k++) one[k]={c,len[c]};
+    vector<HuffEntry> tab(1<<T);
+    for(uint32_t k=0;k<(1u<<T);k++){
+        HuffEntry &e=tab[k];
+        e.sym[0]=one[k].first; e.bits=one[k].second; e.n=e.bits>0;
+        uint32_t rest=(k<<e.bits)&((1<<T)-1);
+        if(e.n && one[rest].second && one[rest].second<=T-e.bits){
+            e.sym[1]=one[rest].first;
+            e.bits+=one[rest].second;
+            e.n=2;
+        }
+    }
+    string out(n+2,'\0');
+    char *o=&out[0],*oe=o+n;
+    const uint8_t *p=z.data()+140,*pe=z.data()+z.size();
+    uint64_t buf=0;
+    int avail=0;
+    auto refill=[&](){
+        if(pe-p>=8){
+            uint64_t w;
+            memcpy(&w,p,8);
+            buf|=__builtin_bswap64(w)>>avail;
+            p+=(63-avail)>>3;
+            avail|=56;
+        } else {
+            while(avail<=56){
+                buf|=(uint64_t)(p<pe?*p++:0)<<(56-avail);
+                avail+=8;
+            }
+        }
+    };
+    auto step=[&](){
+        const HuffEntry &e=tab[buf>>(64-T)];
+        if(!e.n) throw runtime_error("corrupt huffman stream");
+        o[0]=e.sym[0]; o[1]=e.sym[1];
+        o+=e.n;
+        buf<<=e.bits;
+        avail-=e.bits;
+    };
+    while(oe-o>=8){
+        refill();
+        step(); step(); step(); step();
+    }
+    while(o<oe){
+        refill();
+        step();
+    }
+    out.resize(n);
+    return out;
 }
 
 vector<int> buildLPS(string p){
@@ -151,9 +295,32 @@ string genSatelliteData(){
     return s;
 }
 
-int main(){
+double since(chrono::steady_clock::time_point t0){
+    return chrono::duration<double>(chrono::steady_clock::now()-t0).count();
+}
+
+void benchHuff(int mb){
+    string data;
+    while(data.size()<((size_t)mb<<20)) data+=genSatelliteData();
+    auto t0=chrono::steady_clock::now();
+    vector<uint8_t> z=huffCompress(data);
+    double enc=since(t0);
+    t0=chrono::steady_clock::now();
+    string back=huffDecompress(z);
+    double dec=since(t0);
+    double sz=data.size()/1048576.0;
+    cout<<"huffman "<<sz<<" MB -> "<<z.size()/1048576.0<<" MB ratio "<<(double)data.size()/z.size()<<"\n";
+    cout<<"encode "<<sz/enc<<" MB/s decode "<<sz/dec<<" MB/s "<<(back==data?"roundtrip ok":"roundtrip FAILED")<<"\n";
+}
+
+int main(int argc,char** argv){
     srand(time(NULL));
 
+    if(argc>2 && string(argv[1])=="bench" && string(argv[2])=="huff"){
+        benchHuff(argc>3?stoi(argv[3]):256);
+        return 0;
+    }
+
     graphNodes.resize(7);
     for(int i=0;i<7;i++) graphNodes[i].id=i;
 
@@ -177,10 +344,11 @@ int main(){
     vector<int> k1=KMP(data,pat);
     vector<int> k2=rabin(data,pat);
 
-    string encoded=huffEncode(data);
+    vector<uint8_t> packed=huffCompress(data);
+    string unpacked=huffDecompress(packed);
 
     cout<<risk<<"\n";
-    cout<<encoded<<"\n";
+    cout<<data.size()<<" "<<packed.size()<<" "<<(unpacked==data)<<"\n";
     for(int x:k1) cout<<x<<" ";
     cout<<"\n";
     for(int x:k2) cout<<x<<" ";
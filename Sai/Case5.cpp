@@ -1,4 +1,11 @@
 #include <bits/stdc++.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#ifdef __SSE2__
+#include <immintrin.h>
+#endif
 using namespace std;
 
 struct User {
@@ -11,12 +18,6 @@ struct Node {
     vector<int> edges;
 };
 
-struct KeyNode {
-    int key;
-    KeyNode *l, *r;
-    KeyNode(int k):key(k),l(NULL),r(NULL){}
-};
-
 vector<User> users;
 vector<Node> net;
 vector<int> visited1, visited2;
@@ -37,7 +38,7 @@ bool authenticate(string name,string pass){
     return false;
 }
 
-vector<int> buildLPS(string pat){
+vector<int> buildLPS(string_view pat){
     vector<int>l(pat.size(),0);
     int i=1,k=0;
     while(i<pat.size()){
@@ -48,7 +49,7 @@ vector<int> buildLPS(string pat){
     return l;
 }
 
-vector<int> KMPmatch(string txt,string pat){
+vector<int> KMPmatch(string_view txt,string_view pat){
     vector<int>l=buildLPS(pat),res;
     int i=0,j=0;
     while(i<txt.size()){
@@ -64,7 +65,7 @@ vector<int> KMPmatch(string txt,string pat){
     return res;
 }
 
-vector<int> boyer(string txt,string pat){
+vector<int> boyer(string_view txt,string_view pat){
     vector<int>res;
     int n=txt.size(), m=pat.size();
     vector<int>bc(256,-1);
@@ -75,21 +76,21 @@ vector<int> boyer(string txt,string pat){
         while(j>=0 && pat[j]==txt[s+j]) j--;
         if(j<0){
             res.push_back(s);
-            s+=(s+m<n)?m-bc[txt[s+m]]:1;
+            s+=(s+m<n)?m-bc[(unsigned char)txt[s+m]]:1;
         } else {
-            s+=max(1,j-bc[txt[s+j]]);
+            s+=max(1,j-bc[(unsigned char)txt[s+j]]);
         }
     }
     return res;
 }
 
-long long rhash(string s,long long b,long long mod){
+long long rhash(string_view s,long long b,long long mod){
     long long h=0;
     for(char c:s) h=(h*b+c)%mod;
     return h;
 }
 
-vector<int> rabin(string t,string p){
+vector<int> rabin(string_view t,string_view p){
     vector<int>res;
     long long b=257,mod=1e9+7;
     int n=t.size(), m=p.size();
@@ -107,6 +108,73 @@ vector<int> rabin(string t,string p){
     return res;
 }
 
+enum Kernel { K_KMP, K_BOYER, K_RABIN };
+
+vector<int> runKernel(int k,string_view t,string_view p){
+    if(k==K_BOYER) return boyer(t,p);
+    if(k==K_RABIN) return rabin(t,p);
+    return KMPmatch(t,p);
+}
+
+const size_t SHARD_MAX = 64u<<20;
+
+vector<long long> parSearch(string_view buf,string_view pat,int k,int threads){
+    vector<long long> res;
+    size_t n=buf.size(), m=pat.size();
+    if(m==0 || m>n) return res;
+    size_t starts=n-m+1;
+    size_t shards=max<size_t>(threads,(starts+SHARD_MAX-1)/SHARD_MAX);
+    size_t step=(starts+shards-1)/shards;
+    vector<vector<int>> part(shards);
+    atomic<size_t> next(0);
+    auto work=[&](){
+        for(size_t s;(s=next++)<shards;){
+            size_t b=s*step;
+            if(b>=starts) continue;
+            size_t e=min(starts,b+step);
+            part[s]=runKernel(k,buf.substr(b,e-b+m-1),pat);
+        }
+    };
+    vector<thread> pool;
+    for(int i=1;i<threads;i++) pool.emplace_back(work);
+    work();
+    for(auto &t:pool) t.join();
+    size_t tot=0;
+    for(auto &v:part) tot+=v.size();
+    res.reserve(tot);
+    for(size_t s=0;s<shards;s++)
+        for(int x:part[s]) res.push_back((long long)(s*step)+x);
+    return res;
+}
+
+struct MappedFile {
+    const char* data;
+    size_t size;
+};
+
+MappedFile mapFile(const char* path){
+    MappedFile f={NULL,0};
+    int fd=open(path,O_RDONLY);
+    if(fd<0) return f;
+    struct stat st;
+    if(fstat(fd,&st)==0 && st.st_size>0){
+        void* p=mmap(NULL,st.st_size,PROT_READ,MAP_PRIVATE,fd,0);
+        if(p!=MAP_FAILED){
+            madvise(p,st.st_size,MADV_SEQUENTIAL);
+            f.data=(const char*)p;
+            f.size=st.st_size;
+        }
+    }
+    close(fd);
+    return f;
+}
+
+void unmapFile(MappedFile &f){
+    if(f.data) munmap((void*)f.data,f.size);
+    f.data=NULL;
+    f.size=0;
+}
+
 void dfs(int u){
     visited1[u]=1;
     for(int v:net[u].edges)
@@ -129,20 +197,271 @@ void bfs(int s){
     }
 }
 
-KeyNode* insertKey(KeyNode* root,int k){
-    if(!root) return new KeyNode(k);
-    if(k<root->key) root->l=insertKey(root->l,k);
-    else root->r=insertKey(root->r,k);
-    return root;
+const int LEAF_CAP=60, INNER_CAP=24;
+
+struct BLeaf {
+    int n;
+    int keys[LEAF_CAP];
+    int cnt[LEAF_CAP];
+    BLeaf* next;
+};
+
+struct BInner {
+    int n;
+    int keys[INNER_CAP];
+    void* kid[INNER_CAP+1];
+    long long sum[INNER_CAP+1];
+};
+
+int countLess(const int* k,int n,int x){
+#ifdef __SSE2__
+    __m128i v=_mm_set1_epi32(x);
+    int c=0;
+    for(int i=0;i<n;i+=4){
+        __m128i a=_mm_loadu_si128((const __m128i*)(k+i));
+        c+=__builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(a,v))));
+    }
+    return c;
+#else
+    int c=0;
+    for(int i=0;i<n;i++) c+=k[i]<x;
+    return c;
+#endif
 }
 
-void inorderKeys(KeyNode* root, vector<int> &res){
-    if(!root) return;
-    inorderKeys(root->l,res);
-    res.push_back(root->key);
-    inorderKeys(root->r,res);
+int countLessEq(const int* k,int n,int x){
+    return x==INT_MAX?n:countLess(k,n,x+1);
 }
 
+struct BPTree {
+    void* root;
+    int height=0;
+    long long total=0;
+
+    BPTree(){ root=newLeaf(); }
+    BPTree(const BPTree&)=delete;
+    BPTree& operator=(const BPTree&)=delete;
+    ~BPTree(){ release(root,height); }
+
+    static BLeaf* newLeaf(){
+        BLeaf* l=new BLeaf;
+        l->n=0;
+        fill(l->keys,l->keys+LEAF_CAP,INT_MAX);
+        l->next=NULL;
+        return l;
+    }
+    static BInner* newInner(){
+        BInner* in=new BInner;
+        in->n=0;
+        fill(in->keys,in->keys+INNER_CAP,INT_MAX);
+        return in;
+    }
+    static void release(void* p,int h){
+        if(h>0){
+            BInner* in=(BInner*)p;
+            for(int i=0;i<=in->n;i++) release(in->kid[i],h-1);
+            delete in;
+        } else delete (BLeaf*)p;
+    }
+
+    BLeaf* leafFor(int k) const{
+        void* cur=root;
+        for(int h=height;h>0;h--){
+            BInner* in=(BInner*)cur;
+            cur=in->kid[countLessEq(in->keys,in->n,k)];
+        }
+        return (BLeaf*)cur;
+    }
+    BLeaf* firstLeaf() const{
+        void* cur=root;
+        for(int h=height;h>0;h--) cur=((BInner*)cur)->kid[0];
+        return (BLeaf*)cur;
+    }
+
+    int count(int k) const{
+        BLeaf* l=leafFor(k);
+        int p=countLess(l->keys,l->n,k);
+        return p<l->n && l->keys[p]==k?l->cnt[p]:0;
+    }
+
+    void insert(int k,int c=1){
+        BInner* path[64];
+        int idx[64];
+        void* cur=root;
+        for(int h=height;h>0;h--){
+            BInner* in=(BInner*)cur;
+            int i=countLessEq(in->keys,in->n,k);
+            path[h]=in; idx[h]=i;
+            in->sum[i]+=c;
+            cur=in->kid[i];
+        }
+        total+=c;
+        BLeaf* lf=(BLeaf*)cur;
+        int p=countLess(lf->keys,lf->n,k);
+        if(p<lf->n && lf->keys[p]==k){ lf->cnt[p]+=c; return; }
+        if(lf->n<LEAF_CAP){
+            for(int i=lf->n;i>p;i--){ lf->keys[i]=lf->keys[i-1]; lf->cnt[i]=lf->cnt[i-1]; }
+            lf->keys[p]=k; lf->cnt[p]=c; lf->n++;
+            return;
+        }
+        int tk[LEAF_CAP+1],tc[LEAF_CAP+1];
+        copy(lf->keys,lf->keys+p,tk); copy(lf->cnt,lf->cnt+p,tc);
+        tk[p]=k; tc[p]=c;
+        copy(lf->keys+p,lf->keys+LEAF_CAP,tk+p+1); copy(lf->cnt+p,lf->cnt+LEAF_CAP,tc+p+1);
+        int left=p==LEAF_CAP?LEAF_CAP:(LEAF_CAP+1)/2;
+        BLeaf* r=newLeaf();
+        lf->n=left; r->n=LEAF_CAP+1-left;
+        copy(tk,tk+left,lf->keys); copy(tc,tc+left,lf->cnt);
+        fill(lf->keys+left,lf->keys+LEAF_CAP,INT_MAX);
+        copy(tk+left,tk+LEAF_CAP+1,r->keys); copy(tc+left,tc+LEAF_CAP+1,r->cnt);
+        r->next=lf->next; lf->next=r;
+        int up=r->keys[0];
+        void* kid=r;
+        long long rs=0;
+        for(int i=0;i<r->n;i++) rs+=r->cnt[i];
+        for(int h=1;h<=height;h++){
+            BInner* in=path[h];
+            int i=idx[h];
+            if(in->n<INNER_CAP){
+                for(int j=in->n;j>i;j--){ in->keys[j]=in->keys[j-1]; in->kid[j+1]=in->kid[j]; in->sum[j+1]=in->sum[j]; }
+                in->keys[i]=up; in->kid[i+1]=kid; in->n++;
+                in->sum[i]-=rs; in->sum[i+1]=rs;
+                return;
+            }
+            int ik[INNER_CAP+1];
+            void* ic[INNER_CAP+2];
+            copy(in->keys,in->keys+i,ik); ik[i]=up; copy(in->keys+i,in->keys+INNER_CAP,ik+i+1);
+            copy(in->kid,in->kid+i+1,ic); ic[i+1]=kid; copy(in->kid+i+1,in->kid+INNER_CAP+1,ic+i+2);
+            long long is[INNER_CAP+2];
+            copy(in->sum,in->sum+i+1,is); is[i]-=rs; is[i+1]=rs; copy(in->sum+i+1,in->sum+INNER_CAP+1,is+i+2);
+            int lk=i==INNER_CAP?INNER_CAP-1:INNER_CAP/2;
+            BInner* rn=newInner();
+            in->n=lk; rn->n=INNER_CAP-lk;
+            copy(ik,ik+lk,in->keys); fill(in->keys+lk,in->keys+INNER_CAP,INT_MAX);
+            copy(ic,ic+lk+1,in->kid);
+            copy(ik+lk+1,ik+INNER_CAP+1,rn->keys);
+            copy(ic+lk+1,ic+INNER_CAP+2,rn->kid);
+            copy(is,is+lk+1,in->sum); copy(is+lk+1,is+INNER_CAP+2,rn->sum);
+            up=ik[lk]; kid=rn;
+            rs=0;
+            for(int j=0;j<=rn->n;j++) rs+=rn->sum[j];
+        }
+        BInner* nr=newInner();
+        nr->n=1; nr->keys[0]=up;
+        nr->kid[0]=root; nr->kid[1]=kid;
+        nr->sum[0]=total-rs; nr->sum[1]=rs;
+        root=nr; height++;
+    }
+
+    void bulkLoad(const vector<int> &sorted){
+        release(root,height);
+        height=0; total=sorted.size();
+        vector<void*> level;
+        vector<int> lows;
+        vector<long long> sums;
+        BLeaf* prev=NULL;
+        for(size_t i=0;i<sorted.size();){
+            BLeaf* l=newLeaf();
+            long long s=0;
+            while(l->n<LEAF_CAP && i<sorted.size()){
+                size_t j=i;
+                while(j<sorted.size() && sorted[j]==sorted[i]) j++;
+                l->keys[l->n]=sorted[i]; l->cnt[l->n]=j-i; l->n++;
+                s+=j-i; i=j;
+            }
+            if(prev) prev->next=l;
+            prev=l;
+            level.push_back(l); lows.push_back(l->keys[0]); sums.push_back(s);
+        }
+        if(level.empty()){ root=newLeaf(); return; }
+        while(level.size()>1){
+            vector<void*> up;
+            vector<int> upLows;
+            vector<long long> upSums;
+            for(size_t i=0;i<level.size();i+=INNER_CAP+1){
+                BInner* in=newInner();
+                size_t e=min(level.size(),i+INNER_CAP+1);
+                long long s=0;
+                for(size_t j=i;j<e;j++){
+                    in->kid[j-i]=level[j];
+                    in->sum[j-i]=sums[j]; s+=sums[j];
+                    if(j>i) in->keys[j-i-1]=lows[j];
+                }
+                in->n=e-i-1;
+                up.push_back(in); upLows.push_back(lows[i]); upSums.push_back(s);
+            }
+            level.swap(up); lows.swap(upLows); sums.swap(upSums);
+            height++;
+        }
+        root=level[0];
+    }
+
+    static long long below(void* cur,int h,int k,bool eq){
+        long long r=0;
+        for(;h>0;h--){
+            BInner* in=(BInner*)cur;
+            int i=countLessEq(in->keys,in->n,k);
+            for(int j=0;j<i;j++) r+=in->sum[j];
+            cur=in->kid[i];
+        }
+        BLeaf* l=(BLeaf*)cur;
+        int p=eq?countLessEq(l->keys,l->n,k):countLess(l->keys,l->n,k);
+        for(int j=0;j<p;j++) r+=l->cnt[j];
+        return r;
+    }
+
+    long long rank(int k) const{ return below(root,height,k,false); }
+
+    int select(long long r) const{
+        if(r<0 || r>=total) throw out_of_range("select");
+        void* cur=root;
+        for(int h=height;h>0;h--){
+            BInner* in=(BInner*)cur;
+            int i=0;
+            while(r>=in->sum[i]) r-=in->sum[i++];
+            cur=in->kid[i];
+        }
+        BLeaf* l=(BLeaf*)cur;
+        int i=0;
+        while(r>=l->cnt[i]) r-=l->cnt[i++];
+        return l->keys[i];
+    }
+
+    long long countRange(int lo,int hi) const{
+        if(lo>hi) return 0;
+        void* cur=root;
+        for(int h=height;h>0;h--){
+            BInner* in=(BInner*)cur;
+            int a=countLessEq(in->keys,in->n,lo),b=countLessEq(in->keys,in->n,hi);
+            if(a<b){
+                long long r=in->sum[a]-below(in->kid[a],h-1,lo,false)+below(in->kid[b],h-1,hi,true);
+                for(int j=a+1;j<b;j++) r+=in->sum[j];
+                return r;
+            }
+            cur=in->kid[a];
+        }
+        BLeaf* l=(BLeaf*)cur;
+        long long r=0;
+        for(int j=countLess(l->keys,l->n,lo),e=countLessEq(l->keys,l->n,hi);j<e;j++) r+=l->cnt[j];
+        return r;
+    }
+
+    template<class F> void scan(int lo,int hi,F f) const{
+        BLeaf* l=leafFor(lo);
+        int p=countLess(l->keys,l->n,lo);
+        for(;l;l=l->next,p=0)
+            for(;p<l->n;p++){
+                if(l->keys[p]>hi) return;
+                f(l->keys[p],l->cnt[p]);
+            }
+    }
+
+    void dump(vector<int> &v) const{
+        for(BLeaf* l=firstLeaf();l;l=l->next)
+            for(int i=0;i<l->n;i++) v.insert(v.end(),l->cnt[i],l->keys[i]);
+    }
+};
+
 string genLog(){
     vector<string> t={"attack","login","fail","success","malware","scan","alert","trace"};
     string s="";
@@ -154,9 +473,50 @@ string genLog(){
     return s;
 }
 
-int main(){
+void benchShards(int argc,char** argv){
+    string pat=argc>3?argv[3]:"malware";
+    string gen;
+    MappedFile f={NULL,0};
+    string_view buf;
+    if(argc>2 && string(argv[2]).find_first_not_of("0123456789")!=string::npos){
+        f=mapFile(argv[2]);
+        if(!f.data){
+            cout<<"cannot map "<<argv[2]<<"\n";
+            return;
+        }
+        buf=string_view(f.data,f.size);
+    } else {
+        size_t mb=argc>2?stoul(argv[2]):256;
+        gen.reserve(mb<<20);
+        while(gen.size()<(mb<<20)) gen+=genLog();
+        buf=gen;
+    }
+    const char* name[]={"kmp","boyer","rabin"};
+    cout<<"bytes "<<buf.size()<<" pattern "<<pat<<" cores "<<thread::hardware_concurrency()<<"\n";
+    for(int k:{K_KMP,K_BOYER,K_RABIN}){
+        double base=0;
+        size_t hits=0;
+        for(int t:{1,2,4,8,16}){
+            auto t0=chrono::steady_clock::now();
+            vector<long long> r=parSearch(buf,pat,k,t);
+            double sec=chrono::duration<double>(chrono::steady_clock::now()-t0).count();
+            if(t==1){ base=sec; hits=r.size(); }
+            cout<<name[k]<<" threads "<<t<<" "<<sec<<"s "<<buf.size()/sec/1e6<<" MB/s speedup "<<base/sec
+                <<(r.size()==hits?"":" MISMATCH")<<"\n";
+        }
+        cout<<name[k]<<" hits "<<hits<<"\n";
+    }
+    unmapFile(f);
+}
+
+int main(int argc,char** argv){
     srand(time(NULL));
 
+    if(argc>1 && string(argv[1])=="bench"){
+        benchShards(argc,argv);
+        return 0;
+    }
+
     users.push_back({"admin",hashString("strongpass")});
     users.push_back({"user",hashString("pass123")});
 
@@ -176,12 +536,12 @@ int main(){
     dfs(0);
     bfs(0);
 
-    KeyNode* root=NULL;
+    BPTree keyTree;
     for(int k:{50,20,70,10,30,60,90})
-        root=insertKey(root,k);
+        keyTree.insert(k);
 
     vector<int> keys;
-    inorderKeys(root,keys);
+    keyTree.dump(keys);
 
     string log = genLog();
     string pat = "malware";
@@ -189,6 +549,7 @@ int main(){
     vector<int> km = KMPmatch(log,pat);
     vector<int> bm = boyer(log,pat);
     vector<int> rk = rabin(log,pat);
+    vector<long long> ps = parSearch(log,pat,K_KMP,4);
 
     cout<<authenticate("admin","strongpass")<<"\n";
     cout<<authenticate("admin","wrong")<<"\n";
@@ -211,6 +572,9 @@ int main(){
     for(int x:rk) cout<<x<<" ";
     cout<<"\n";
 
+    for(long long x:ps) cout<<x<<" ";
+    cout<<"\n";
+
     cout<<log<<"\n";
 
     return 0;
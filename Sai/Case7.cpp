@@ -1,4 +1,7 @@
 #include <bits/stdc++.h>
+#ifdef __SSE2__
+#include <immintrin.h>
+#endif
 using namespace std;
 
 struct AVL {
@@ -56,42 +59,373 @@ void inorderAVL(AVL* root, vector<int> &v){
     inorderAVL(root->r,v);
 }
 
+const int LEAF_CAP=60, INNER_CAP=24;
+
+struct BLeaf {
+    int n;
+    int keys[LEAF_CAP];
+    int cnt[LEAF_CAP];
+    BLeaf* next;
+};
+
+struct BInner {
+    int n;
+    int keys[INNER_CAP];
+    void* kid[INNER_CAP+1];
+    long long sum[INNER_CAP+1];
+};
+
+int countLess(const int* k,int n,int x){
+#ifdef __SSE2__
+    __m128i v=_mm_set1_epi32(x);
+    int c=0;
+    for(int i=0;i<n;i+=4){
+        __m128i a=_mm_loadu_si128((const __m128i*)(k+i));
+        c+=__builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(a,v))));
+    }
+    return c;
+#else
+    int c=0;
+    for(int i=0;i<n;i++) c+=k[i]<x;
+    return c;
+#endif
+}
+
+int countLessEq(const int* k,int n,int x){
+    return x==INT_MAX?n:countLess(k,n,x+1);
+}
+
+struct BPTree {
+    void* root;
+    int height=0;
+    long long total=0;
+
+    BPTree(){ root=newLeaf(); }
+    BPTree(const BPTree&)=delete;
+    BPTree& operator=(const BPTree&)=delete;
+    ~BPTree(){ release(root,height); }
+
+    static BLeaf* newLeaf(){
+        BLeaf* l=new BLeaf;
+        l->n=0;
+        fill(l->keys,l->keys+LEAF_CAP,INT_MAX);
+        l->next=NULL;
+        return l;
+    }
+    static BInner* newInner(){
+        BInner* in=new BInner;
+        in->n=0;
+        fill(in->keys,in->keys+INNER_CAP,INT_MAX);
+        return in;
+    }
+    static void release(void* p,int h){
+        if(h>0){
+            BInner* in=(BInner*)p;
+            for(int i=0;i<=in->n;i++) release(in->kid[i],h-1);
+            delete in;
+        } else delete (BLeaf*)p;
+    }
+
+    BLeaf* leafFor(int k) const{
+        void* cur=root;
+        for(int h=height;h>0;h--){
+            BInner* in=(BInner*)cur;
+            cur=in->kid[countLessEq(in->keys,in->n,k)];
+        }
+        return (BLeaf*)cur;
+    }
+    BLeaf* firstLeaf() const{
+        void* cur=root;
+        for(int h=height;h>0;h--) cur=((BInner*)cur)->kid[0];
+        return (BLeaf*)cur;
+    }
+
+    int count(int k) const{
+        BLeaf* l=leafFor(k);
+        int p=countLess(l->keys,l->n,k);
+        return p<l->n && l->keys[p]==k?l->cnt[p]:0;
+    }
+
+    void insert(int k,int c=1){
+        BInner* path[64];
+        int idx[64];
+        void* cur=root;
+        for(int h=height;h>0;h--){
+            BInner* in=(BInner*)cur;
+            int i=countLessEq(in->keys,in->n,k);
+            path[h]=in; idx[h]=i;
+            in->sum[i]+=c;
+            cur=in->kid[i];
+        }
+        total+=c;
+        BLeaf* lf=(BLeaf*)cur;
+        int p=countLess(lf->keys,lf->n,k);
+        if(p<lf->n && lf->keys[p]==k){ lf->cnt[p]+=c; return; }
+        if(lf->n<LEAF_CAP){
+            for(int i=lf->n;i>p;i--){ lf->keys[i]=lf->keys[i-1]; lf->cnt[i]=lf->cnt[i-1]; }
+            lf->keys[p]=k; lf->cnt[p]=c; lf->n++;
+            return;
+        }
+        int tk[LEAF_CAP+1],tc[LEAF_CAP+1];
+        copy(lf->keys,lf->keys+p,tk); copy(lf->cnt,lf->cnt+p,tc);
+        tk[p]=k; tc[p]=c;
+        copy(lf->keys+p,lf->keys+LEAF_CAP,tk+p+1); copy(lf->cnt+p,lf->cnt+LEAF_CAP,tc+p+1);
+        int left=p==LEAF_CAP?LEAF_CAP:(LEAF_CAP+1)/2;
+        BLeaf* r=newLeaf();
+        lf->n=left; r->n=LEAF_CAP+1-left;
+        copy(tk,tk+left,lf->keys); copy(tc,tc+left,lf->cnt);
+        fill(lf->keys+left,lf->keys+LEAF_CAP,INT_MAX);
+        copy(tk+left,tk+LEAF_CAP+1,r->keys); copy(tc+left,tc+LEAF_CAP+1,r->cnt);
+        r->next=lf->next; lf->next=r;
+        int up=r->keys[0];
+        void* kid=r;
+        long long rs=0;
+        for(int i=0;i<r->n;i++) rs+=r->cnt[i];
+        for(int h=1;h<=height;h++){
+            BInner* in=path[h];
+            int i=idx[h];
+            if(in->n<INNER_CAP){
+                for(int j=in->n;j>i;j--){ in->keys[j]=in->keys[j-1]; in->kid[j+1]=in->kid[j]; in->sum[j+1]=in->sum[j]; }
+                in->keys[i]=up; in->kid[i+1]=kid; in->n++;
+                in->sum[i]-=rs; in->sum[i+1]=rs;
+                return;
+            }
+            int ik[INNER_CAP+1];
+            void* ic[INNER_CAP+2];
+            copy(in->keys,in->keys+i,ik); ik[i]=up; copy(in->keys+i,in->keys+INNER_CAP,ik+i+1);
+            copy(in->kid,in->kid+i+1,ic); ic[i+1]=kid; copy(in->kid+i+1,in->kid+INNER_CAP+1,ic+i+2);
+            long long is[INNER_CAP+2];
+            copy(in->sum,in->sum+i+1,is); is[i]-=rs; is[i+1]=rs; copy(in->sum+i+1,in->sum+INNER_CAP+1,is+i+2);
+            int lk=i==INNER_CAP?INNER_CAP-1:INNER_CAP/2;
+            BInner* rn=newInner();
+            in->n=lk; rn->n=INNER_CAP-lk;
+            copy(ik,ik+lk,in->keys); fill(in->keys+lk,in->keys+INNER_CAP,INT_MAX);
+            copy(ic,ic+lk+1,in->kid);
+            copy(ik+lk+1,ik+INNER_CAP+1,rn->keys);
+            copy(ic+lk+1,ic+INNER_CAP+2,rn->kid);
+            copy(is,is+lk+1,in->sum); copy(is+lk+1,is+INNER_CAP+2,rn->sum);
+            up=ik[lk]; kid=rn;
+            rs=0;
+            for(int j=0;j<=rn->n;j++) rs+=rn->sum[j];
+        }
+        BInner* nr=newInner();
+        nr->n=1; nr->keys[0]=up;
+        nr->kid[0]=root; nr->kid[1]=kid;
+        nr->sum[0]=total-rs; nr->sum[1]=rs;
+        root=nr; height++;
+    }
+
+    void bulkLoad(const vector<int> &sorted){
+        release(root,height);
+        height=0; total=sorted.size();
+        vector<void*> level;
+        vector<int> lows;
+        vector<long long> sums;
+        BLeaf* prev=NULL;
+        for(size_t i=0;i<sorted.size();){
+            BLeaf* l=newLeaf();
+            long long s=0;
+            while(l->n<LEAF_CAP && i<sorted.size()){
+                size_t j=i;
+                while(j<sorted.size() && sorted[j]==sorted[i]) j++;
+                l->keys[l->n]=sorted[i]; l->cnt[l->n]=j-i; l->n++;
+                s+=j-i; i=j;
+            }
+            if(prev) prev->next=l;
+            prev=l;
+            level.push_back(l); lows.push_back(l->keys[0]); sums.push_back(s);
+        }
+        if(level.empty()){ root=newLeaf(); return; }
+        while(level.size()>1){
+            vector<void*> up;
+            vector<int> upLows;
+            vector<long long> upSums;
+            for(size_t i=0;i<level.size();i+=INNER_CAP+1){
+                BInner* in=newInner();
+                size_t e=min(level.size(),i+INNER_CAP+1);
+                long long s=0;
+                for(size_t j=i;j<e;j++){
+                    in->kid[j-i]=level[j];
+                    in->sum[j-i]=sums[j]; s+=sums[j];
+                    if(j>i) in->keys[j-i-1]=lows[j];
+                }
+                in->n=e-i-1;
+                up.push_back(in); upLows.push_back(lows[i]); upSums.push_back(s);
+            }
+            level.swap(up); lows.swap(upLows); sums.swap(upSums);
+            height++;
+        }
+        root=level[0];
+    }
+
+    static long long below(void* cur,int h,int k,bool eq){
+        long long r=0;
+        for(;h>0;h--){
+            BInner* in=(BInner*)cur;
+            int i=countLessEq(in->keys,in->n,k);
+            for(int j=0;j<i;j++) r+=in->sum[j];
+            cur=in->kid[i];
+        }
+        BLeaf* l=(BLeaf*)cur;
+        int p=eq?countLessEq(l->keys,l->n,k):countLess(l->keys,l->n,k);
+        for(int j=0;j<p;j++) r+=l->cnt[j];
+        return r;
+    }
+
+    long long rank(int k) const{ return below(root,height,k,false); }
+
+    int select(long long r) const{
+        if(r<0 || r>=total) throw out_of_range("select");
+        void* cur=root;
+        for(int h=height;h>0;h--){
+            BInner* in=(BInner*)cur;
+            int i=0;
+            while(r>=in->sum[i]) r-=in->sum[i++];
+            cur=in->kid[i];
+        }
+        BLeaf* l=(BLeaf*)cur;
+        int i=0;
+        while(r>=l->cnt[i]) r-=l->cnt[i++];
+        return l->keys[i];
+    }
+
+    long long countRange(int lo,int hi) const{
+        if(lo>hi) return 0;
+        void* cur=root;
+        for(int h=height;h>0;h--){
+            BInner* in=(BInner*)cur;
+            int a=countLessEq(in->keys,in->n,lo),b=countLessEq(in->keys,in->n,hi);
+            if(a<b){
+                long long r=in->sum[a]-below(in->kid[a],h-1,lo,false)+below(in->kid[b],h-1,hi,true);
+                for(int j=a+1;j<b;j++) r+=in->sum[j];
+                return r;
+            }
+            cur=in->kid[a];
+        }
+        BLeaf* l=(BLeaf*)cur;
+        long long r=0;
+        for(int j=countLess(l->keys,l->n,lo),e=countLessEq(l->keys,l->n,hi);j<e;j++) r+=l->cnt[j];
+        return r;
+    }
+
+    template<class F> void scan(int lo,int hi,F f) const{
+        BLeaf* l=leafFor(lo);
+        int p=countLess(l->keys,l->n,lo);
+        for(;l;l=l->next,p=0)
+            for(;p<l->n;p++){
+                if(l->keys[p]>hi) return;
+                f(l->keys[p],l->cnt[p]);
+            }
+    }
+
+    void dump(vector<int> &v) const{
+        for(BLeaf* l=firstLeaf();l;l=l->next)
+            for(int i=0;i<l->n;i++) v.insert(v.end(),l->cnt[i],l->keys[i]);
+    }
+};
+
 struct T23 {
-    int val1,val2;
-    bool two;
-    T23* c1,*c2,*c3;
-    T23(int v):val1(v),two(true),c1(NULL),c2(NULL),c3(NULL){}
+    int n;
+    int key[2];
+    T23* kid[3];
+    T23(int v):n(1){ key[0]=v; kid[0]=kid[1]=kid[2]=NULL; }
 };
 
-T23* insert23(T23* node,int v){
-    if(!node) return new T23(v);
-    if(node->two){
-        if(v<node->val1){
-            node->val2=node->val1;
-            node->val1=v;
-        } else node->val2=v;
-        node->two=false;
-        return node;
-    }
-    if(v<node->val1) node->c1=insert23(node->c1,v);
-    else if(v>node->val2) node->c3=insert23(node->c3,v);
-    else node->c2=insert23(node->c2,v);
-    return node;
+T23* insert23(T23* root,int v){
+    if(!root) return new T23(v);
+    T23* path[64];
+    int idx[64],d=0;
+    for(T23* cur=root;cur;d++){
+        int i=(v>=cur->key[0])+(cur->n==2 && v>=cur->key[1]);
+        path[d]=cur; idx[d]=i;
+        cur=cur->kid[i];
+    }
+    int up=v;
+    T23* right=NULL;
+    while(d--){
+        T23* nd=path[d];
+        int i=idx[d];
+        if(nd->n==1){
+            if(i==0){
+                nd->key[1]=nd->key[0]; nd->kid[2]=nd->kid[1];
+                nd->key[0]=up; nd->kid[1]=right;
+            } else {
+                nd->key[1]=up; nd->kid[2]=right;
+            }
+            nd->n=2;
+            return root;
+        }
+        int k[3];
+        T23* c[4];
+        for(int j=0,s=0;j<3;j++) k[j]= j==i?up:nd->key[s++];
+        for(int j=0,s=0;j<4;j++) c[j]= j==i+1?right:nd->kid[s++];
+        T23* r=new T23(k[2]);
+        r->kid[0]=c[2]; r->kid[1]=c[3];
+        nd->n=1; nd->key[0]=k[0];
+        nd->kid[0]=c[0]; nd->kid[1]=c[1]; nd->kid[2]=NULL;
+        up=k[1]; right=r;
+    }
+    T23* nr=new T23(up);
+    nr->kid[0]=root; nr->kid[1]=right;
+    return nr;
 }
 
-void inorder23(T23* n, vector<int> &v){
+void free23(T23* n){
     if(!n) return;
-    if(n->two){
-        inorder23(n->c1,v);
-        v.push_back(n->val1);
-        inorder23(n->c2,v);
-    } else {
-        inorder23(n->c1,v);
-        v.push_back(n->val1);
-        inorder23(n->c2,v);
-        v.push_back(n->val2);
-        inorder23(n->c3,v);
+    for(int i=0;i<=n->n;i++) free23(n->kid[i]);
+    delete n;
+}
+
+void inorder23(T23* n, vector<int> &v){
+    T23* st[64];
+    int step[64],d=0;
+    if(n){ st[0]=n; step[0]=0; d=1; }
+    while(d){
+        T23* nd=st[d-1];
+        int i=step[d-1]++;
+        if(i>2*nd->n) d--;
+        else if(i&1) v.push_back(nd->key[i/2]);
+        else if(nd->kid[i/2]){ st[d]=nd->kid[i/2]; step[d]=0; d++; }
+    }
+}
+
+T23* build23(vector<int> keys){
+    vector<T23*> kids(keys.size()+1,NULL);
+    while(kids.size()>1){
+        size_t c=kids.size(),g=(c+2)/3,threes=c-2*g,p=0;
+        vector<T23*> up;
+        vector<int> upKeys;
+        for(size_t j=0;j<g;j++){
+            int sz=j<threes?3:2;
+            T23* nd=new T23(keys[p]);
+            nd->n=sz-1;
+            for(int t=0;t<sz;t++){
+                nd->kid[t]=kids[p+t];
+                if(t) nd->key[t-1]=keys[p+t-1];
+            }
+            p+=sz;
+            up.push_back(nd);
+            if(p<c) upKeys.push_back(keys[p-1]);
+        }
+        kids.swap(up); keys.swap(upKeys);
+    }
+    return kids[0];
+}
+
+T23* bulkInsert23(T23* root,vector<int> vals){
+    int h=0;
+    for(T23* n=root;n;n=n->kid[0]) h++;
+    if(vals.size()<64 || (h<40 && (vals.size()<<4)<(1ull<<h))){
+        for(int x:vals) root=insert23(root,x);
+        return root;
     }
+    if(!is_sorted(vals.begin(),vals.end())) sort(vals.begin(),vals.end());
+    vector<int> old,all;
+    inorder23(root,old);
+    free23(root);
+    all.resize(old.size()+vals.size());
+    merge(old.begin(),old.end(),vals.begin(),vals.end(),all.begin());
+    return build23(all);
 }
 
 vector<vector<int>> city;
@@ -184,14 +518,185 @@ vector<int> KMP(string t,string p){
     return res;
 }
 
-int main(){
+double since(chrono::steady_clock::time_point t0){
+    return chrono::duration<double>(chrono::steady_clock::now()-t0).count();
+}
+
+int findAVL(AVL* n,int k){
+    int c=0;
+    while(n){
+        if(k<n->key) n=n->l;
+        else {
+            if(k==n->key) c++;
+            n=n->r;
+        }
+    }
+    return c;
+}
+
+void benchBTree(int n){
+    mt19937 rng(3);
+    vector<int> keys(n);
+    for(int i=0;i<n;i++) keys[i]=2*i+rng()%2;
+    shuffle(keys.begin(),keys.end(),rng);
+    vector<int> probe(1000000);
+    for(int &k:probe) k=rng()%(2*n);
+    cout<<"ordered index "<<n<<" distinct random keys\n";
+
+    auto t0=chrono::steady_clock::now();
+    AVL* avl=NULL;
+    for(int k:keys) avl=insertAVL(avl,k);
+    double ins=since(t0);
+    t0=chrono::steady_clock::now();
+    long long hits=0;
+    for(int k:probe) hits+=findAVL(avl,k);
+    double look=since(t0);
+    cout<<"avl insert "<<ins/n*1e9<<" ns lookup "<<look/probe.size()*1e9<<" ns hits "<<hits<<" nodes "
+        <<n*sizeof(AVL)/1048576.0<<" MB\n";
+
+    BPTree bt;
+    t0=chrono::steady_clock::now();
+    for(int k:keys) bt.insert(k);
+    ins=since(t0);
+    t0=chrono::steady_clock::now();
+    long long hits2=0;
+    for(int k:probe) hits2+=bt.count(k);
+    look=since(t0);
+    cout<<"b+tree insert "<<ins/n*1e9<<" ns lookup "<<look/probe.size()*1e9<<" ns hits "<<hits2
+        <<(hits==hits2?"":" MISMATCH")<<" height "<<bt.height<<"\n";
+
+    vector<int> sorted=keys;
+    sort(sorted.begin(),sorted.end());
+    BPTree bulk;
+    t0=chrono::steady_clock::now();
+    bulk.bulkLoad(sorted);
+    cout<<"b+tree bulk load "<<since(t0)/n*1e9<<" ns/key\n";
+    BPTree seq;
+    t0=chrono::steady_clock::now();
+    for(int k:sorted) seq.insert(k);
+    cout<<"b+tree sorted insert "<<since(t0)/n*1e9<<" ns/key height "<<seq.height<<"\n";
+    t0=chrono::steady_clock::now();
+    long long scanned=0;
+    for(int i=0;i<1000;i++){
+        int lo=rng()%(2*n);
+        bulk.scan(lo,lo+n/100,[&](int,int c){ scanned+=c; });
+    }
+    double sc=since(t0);
+    cout<<"b+tree range scan "<<scanned/sc/1e6<<" M keys/s\n";
+}
+
+void bench23(int n){
+    mt19937 rng(4);
+    vector<int> keys(n);
+    for(int i=0;i<n;i++) keys[i]=i;
+    for(int i=0;i+1<n;i++) if(rng()%8==0) swap(keys[i],keys[min(n-1,i+1+(int)(rng()%16))]);
+    cout<<"2-3 tree "<<n<<" nearly sorted keys\n";
+
+    auto t0=chrono::steady_clock::now();
+    T23* t=NULL;
+    for(int k:keys) t=insert23(t,k);
+    double ins=since(t0);
+    int h=0;
+    for(T23* x=t;x;x=x->kid[0]) h++;
+    t0=chrono::steady_clock::now();
+    vector<int> v;
+    inorder23(t,v);
+    double walk=since(t0);
+    cout<<"insert "<<ins/n*1e9<<" ns/key height "<<h<<" inorder "<<walk/n*1e9<<" ns/key "
+        <<(is_sorted(v.begin(),v.end())?"sorted":"UNSORTED")<<"\n";
+    free23(t);
+
+    t0=chrono::steady_clock::now();
+    t=bulkInsert23(NULL,keys);
+    cout<<"bulk insert "<<since(t0)/n*1e9<<" ns/key\n";
+    vector<int> more(n/10);
+    for(int &k:more) k=rng()%n;
+    t0=chrono::steady_clock::now();
+    t=bulkInsert23(t,more);
+    cout<<"bulk merge of "<<more.size()<<" keys "<<since(t0)*1e3<<" ms\n";
+    free23(t);
+}
+
+void benchRank(int n){
+    mt19937 rng(5);
+    vector<int> keys(n);
+    for(int &k:keys) k=rng()%(4*n);
+    int q=1000000;
+    vector<int> lo(q),hi(q);
+    vector<long long> pos(q);
+    for(int i=0;i<q;i++){ lo[i]=rng()%(4*n); hi[i]=lo[i]+rng()%1000; pos[i]=rng()%n; }
+    cout<<"order statistics "<<n<<" keys "<<q<<" queries each\n";
+
+    BPTree bt;
+    for(int k:keys) bt.insert(k);
+    long long a=0,b=0;
+    auto t0=chrono::steady_clock::now();
+    for(int i=0;i<q;i++) a+=bt.rank(lo[i]);
+    double rk=since(t0);
+    t0=chrono::steady_clock::now();
+    for(int i=0;i<q;i++) a+=bt.select(pos[i]);
+    double sel=since(t0);
+    t0=chrono::steady_clock::now();
+    for(int i=0;i<q;i++) a+=bt.countRange(lo[i],hi[i]);
+    double cr=since(t0);
+    cout<<"b+tree rank "<<q/rk/1e6<<" M/s select "<<q/sel/1e6<<" M/s countRange "<<q/cr/1e6<<" M/s\n";
+
+    t0=chrono::steady_clock::now();
+    vector<int> v;
+    bt.dump(v);
+    double dump=since(t0);
+    t0=chrono::steady_clock::now();
+    for(int i=0;i<q;i++) b+=lower_bound(v.begin(),v.end(),lo[i])-v.begin();
+    rk=since(t0);
+    t0=chrono::steady_clock::now();
+    for(int i=0;i<q;i++) b+=v[pos[i]];
+    sel=since(t0);
+    t0=chrono::steady_clock::now();
+    for(int i=0;i<q;i++) b+=upper_bound(v.begin(),v.end(),hi[i])-lower_bound(v.begin(),v.end(),lo[i]);
+    cr=since(t0);
+    cout<<"dump "<<dump*1e3<<" ms then binary search rank "<<q/rk/1e6<<" M/s select "<<q/sel/1e6
+        <<" M/s countRange "<<q/cr/1e6<<" M/s"<<(a==b?"":" MISMATCH")<<"\n";
+
+    // interleaved: every query batch follows fresh inserts, so the dump must be redone
+    int rounds=20,batch=1000;
+    t0=chrono::steady_clock::now();
+    for(int r=0;r<rounds;r++){
+        for(int i=0;i<batch;i++) bt.insert(rng()%(4*n));
+        for(int i=0;i<batch;i++) a+=bt.countRange(lo[i],hi[i]);
+    }
+    double tree=since(t0);
+    t0=chrono::steady_clock::now();
+    for(int r=0;r<rounds;r++){
+        for(int i=0;i<batch;i++) bt.insert(rng()%(4*n));
+        v.clear();
+        bt.dump(v);
+        for(int i=0;i<batch;i++) b+=upper_bound(v.begin(),v.end(),hi[i])-lower_bound(v.begin(),v.end(),lo[i]);
+    }
+    double redump=since(t0);
+    cout<<"insert+query rounds: b+tree "<<tree/rounds*1e3<<" ms/round, dump+search "<<redump/rounds*1e3<<" ms/round\n";
+}
+
+int main(int argc,char** argv){
     srand(time(NULL));
 
-    AVL* root=NULL;
+    if(argc>2 && string(argv[1])=="bench" && string(argv[2])=="btree"){
+        benchBTree(argc>3?stoi(argv[3]):10000000);
+        return 0;
+    }
+    if(argc>2 && string(argv[1])=="bench" && string(argv[2])=="rank"){
+        benchRank(argc>3?stoi(argv[3]):10000000);
+        return 0;
+    }
+    if(argc>2 && string(argv[1])=="bench" && string(argv[2])=="t23"){
+        bench23(argc>3?stoi(argv[3]):10000000);
+        return 0;
+    }
+
+    BPTree keyTree;
     for(int x:{10,20,5,15,30,25,35})
-        root=insertAVL(root,x);
-    vector<int> avlv;
-    inorderAVL(root,avlv);
+        keyTree.insert(x);
+    vector<int> keyv;
+    keyTree.dump(keyv);
 
     T23* troot=NULL;
     for(int x:{5,2,8,1,3,7,9})
@@ -221,8 +726,9 @@ int main(){
     cout<<tspres<<"\n";
     cout<<pred<<"\n";
 
-    for(int a:avlv) cout<<a<<" ";
+    for(int a:keyv) cout<<a<<" ";
     cout<<"\n";
+    cout<<keyTree.rank(20)<<" "<<keyTree.select(2)<<" "<<keyTree.countRange(12,30)<<"\n";
 
     for(int a:t23v) cout<<a<<" ";
     cout<<"\n";
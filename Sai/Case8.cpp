@@ -9,39 +9,100 @@ struct Zone {
 
 vector<Zone> zones;
 vector<int> visited;
-vector<int> segtree, arr;
+vector<long long> arr;
 
 int n = 10;
 
-void buildSeg(int idx,int l,int r){
-    if(l==r){
-        segtree[idx]=arr[l];
-        return;
-    }
-    int m=(l+r)/2;
-    buildSeg(idx*2,l,m);
-    buildSeg(idx*2+1,m+1,r);
-    segtree[idx]=segtree[idx*2]+segtree[idx*2+1];
-}
+struct AddSum {
+    using T=long long;
+    using F=long long;
+    static T id(){ return 0; }
+    static T op(T a,T b){ return a+b; }
+    static F fid(){ return 0; }
+    static T apply(F f,T x,int len){ return x+f*len; }
+    static F compose(F f,F g){ return f+g; }
+};
 
-void updateSeg(int idx,int l,int r,int pos,int val){
-    if(l==r){
-        segtree[idx]=val;
-        return;
-    }
-    int m=(l+r)/2;
-    if(pos<=m) updateSeg(idx*2,l,m,pos,val);
-    else updateSeg(idx*2+1,m+1,r,pos,val);
-    segtree[idx]=segtree[idx*2]+segtree[idx*2+1];
-}
+struct AddMax {
+    using T=long long;
+    using F=long long;
+    static T id(){ return LLONG_MIN; }
+    static T op(T a,T b){ return max(a,b); }
+    static F fid(){ return 0; }
+    static T apply(F f,T x,int){ return x==LLONG_MIN?x:x+f; }
+    static F compose(F f,F g){ return f+g; }
+};
 
-int querySeg(int idx,int l,int r,int ql,int qr){
-    if(qr<l || ql>r) return 0;
-    if(ql<=l && r<=qr) return segtree[idx];
-    int m=(l+r)/2;
-    return querySeg(idx*2,l,m,ql,qr)+
-           querySeg(idx*2+1,m+1,r,ql,qr);
-}
+template<class M>
+struct LazySeg {
+    using T=typename M::T;
+    using F=typename M::F;
+    int n,lg,sz;
+    vector<T> d;
+    vector<F> lz;
+    LazySeg(const vector<T>&v):n(v.size()){
+        lg=0;
+        while((1<<lg)<n) lg++;
+        sz=1<<lg;
+        d.assign(2*sz,M::id());
+        lz.assign(sz,M::fid());
+        copy(v.begin(),v.end(),d.begin()+sz);
+        for(int i=sz-1;i>=1;i--) pull(i);
+    }
+    int len(int k) const{ return sz>>(31-__builtin_clz(k)); }
+    void pull(int k){ d[k]=M::op(d[2*k],d[2*k+1]); }
+    void put(int k,F f){
+        d[k]=M::apply(f,d[k],len(k));
+        if(k<sz) lz[k]=M::compose(f,lz[k]);
+    }
+    void push(int k){
+        if(lz[k]==M::fid()) return;
+        put(2*k,lz[k]);
+        put(2*k+1,lz[k]);
+        lz[k]=M::fid();
+    }
+    void set(int p,T x){
+        p+=sz;
+        for(int i=lg;i>=1;i--) push(p>>i);
+        d[p]=x;
+        for(int i=1;i<=lg;i++) pull(p>>i);
+    }
+    T query(int l,int r){
+        if(l>r) return M::id();
+        l+=sz; r+=sz+1;
+        for(int i=lg;i>=1;i--){
+            if(((l>>i)<<i)!=l) push(l>>i);
+            if(((r>>i)<<i)!=r) push((r-1)>>i);
+        }
+        T sl=M::id(),sr=M::id();
+        while(l<r){
+            if(l&1) sl=M::op(sl,d[l++]);
+            if(r&1) sr=M::op(d[--r],sr);
+            l>>=1; r>>=1;
+        }
+        return M::op(sl,sr);
+    }
+    void update(int l,int r,F f){
+        if(l>r) return;
+        l+=sz; r+=sz+1;
+        for(int i=lg;i>=1;i--){
+            if(((l>>i)<<i)!=l) push(l>>i);
+            if(((r>>i)<<i)!=r) push((r-1)>>i);
+        }
+        int l2=l,r2=r;
+        while(l<r){
+            if(l&1) put(l++,f);
+            if(r&1) put(--r,f);
+            l>>=1; r>>=1;
+        }
+        l=l2; r=r2;
+        for(int i=1;i<=lg;i++){
+            if(((l>>i)<<i)!=l) pull(l>>i);
+            if(((r>>i)<<i)!=r) pull((r-1)>>i);
+        }
+    }
+    T all() const{ return d[1]; }
+};
 
 void bfs(int s){
     visited.assign(n,0);
@@ -156,8 +217,7 @@ int main(){
 
     arr.resize(n);
     for(int i=0;i<n;i++) arr[i]=zones[i].energy;
-    segtree.resize(4*n);
-    buildSeg(1,0,n-1);
+    LazySeg<AddSum> energySum(arr);
 
     bfs(0);
 
@@ -168,7 +228,7 @@ int main(){
     vector<int> km = KMP(ev,pat);
     vector<int> rk = rabin(ev,pat);
 
-    cout<<querySeg(1,0,n-1,0,5)<<"\n";
+    cout<<energySum.query(0,5)<<"\n";
 
     for(int x:g) cout<<x<<" ";
     cout<<"\n";
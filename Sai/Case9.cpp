@@ -1,4 +1,10 @@
 #include <bits/stdc++.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#ifdef __SSE2__
+#include <immintrin.h>
+#endif
 using namespace std;
 
 struct Trie {
@@ -39,13 +45,479 @@ void autoComplete(Trie* cur,string pref,vector<string>&res){
     }
 }
 
-string hashKey(string s){
-    long long h=0,base=257,mod=1e9+7;
-    for(char c:s) h=(h*base+c)%mod;
-    return to_string(h);
+void freeTrie(Trie* t){
+    vector<Trie*> st;
+    if(t) st.push_back(t);
+    while(!st.empty()){
+        Trie* cur=st.back();
+        st.pop_back();
+        for(int i=0;i<256;i++) if(cur->child[i]) st.push_back(cur->child[i]);
+        delete cur;
+    }
+}
+
+struct DATrie {
+    vector<int> base, check;
+    vector<unsigned char> child, sib;
+    vector<uint64_t> endBit, kidBit, sibBit;
+    int nodes=0;
+};
+
+bool getBit(const vector<uint64_t>&b,int i){ return b[i>>6]>>(i&63)&1; }
+void setBit(vector<uint64_t>&b,int i){ b[i>>6]|=1ULL<<(i&63); }
+
+struct DABuilder {
+    DATrie &t;
+    const vector<string> &keys;
+    vector<int> nextFree, prevFree;
+    vector<unsigned char> fails;
+    int firstFree=-1, lastFree=-1;
+
+    DABuilder(DATrie &t,const vector<string>&k):t(t),keys(k){
+        grow(1024);
+        use(0);
+        t.check[0]=-2;
+    }
+
+    void grow(int sz){
+        int old=t.base.size();
+        t.base.resize(sz,0);
+        t.check.resize(sz,-1);
+        t.child.resize(sz,0);
+        t.sib.resize(sz,0);
+        for(auto b:{&t.endBit,&t.kidBit,&t.sibBit}) b->resize((sz+63)/64,0);
+        nextFree.resize(sz);
+        prevFree.resize(sz);
+        fails.resize(sz,0);
+        for(int i=old;i<sz;i++){
+            prevFree[i]=lastFree;
+            nextFree[i]=-1;
+            if(lastFree>=0) nextFree[lastFree]=i;
+            else firstFree=i;
+            lastFree=i;
+        }
+    }
+
+    void unlink(int i){
+        int p=prevFree[i], n=nextFree[i];
+        if(p>=0) nextFree[p]=n; else firstFree=n;
+        if(n>=0) prevFree[n]=p; else lastFree=p;
+    }
+
+    void use(int i){
+        if(fails[i]<16) unlink(i);
+        t.check[i]=0;
+    }
+
+    int findBase(const vector<unsigned char>&lab){
+        if(firstFree<0) grow(t.base.size()*2);
+        for(int e=firstFree;;){
+            int b=e-lab[0];
+            if(b+256>(int)t.base.size()) grow(t.base.size()*2);
+            bool ok=b>=1;
+            for(size_t j=1;j<lab.size() && ok;j++)
+                if(t.check[b+lab[j]]!=-1) ok=false;
+            if(ok) return b;
+            if(nextFree[e]<0) grow(t.base.size()*2);
+            int n=nextFree[e];
+            if(++fails[e]==16) unlink(e);
+            e=n;
+        }
+    }
+
+    void build(int s,int lo,int hi,int depth){
+        t.nodes++;
+        if(lo<hi && keys[lo].size()==(size_t)depth){
+            setBit(t.endBit,s);
+            lo++;
+        }
+        if(lo>=hi) return;
+        vector<unsigned char> lab;
+        vector<int> from;
+        for(int i=lo;i<hi;i++){
+            unsigned char c=keys[i][depth];
+            if(lab.empty() || lab.back()!=c){
+                lab.push_back(c);
+                from.push_back(i);
+            }
+        }
+        from.push_back(hi);
+        int b=findBase(lab);
+        t.base[s]=b;
+        t.child[s]=lab[0];
+        setBit(t.kidBit,s);
+        for(size_t j=0;j<lab.size();j++){
+            use(b+lab[j]);
+            t.check[b+lab[j]]=s;
+            if(j+1<lab.size()){
+                t.sib[b+lab[j]]=lab[j+1];
+                setBit(t.sibBit,b+lab[j]);
+            }
+        }
+        for(size_t j=0;j<lab.size();j++)
+            build(b+lab[j],from[j],from[j+1],depth+1);
+    }
+};
+
+DATrie buildDATrie(vector<string> keys){
+    sort(keys.begin(),keys.end());
+    keys.erase(unique(keys.begin(),keys.end()),keys.end());
+    DATrie t;
+    DABuilder bld(t,keys);
+    bld.build(0,0,keys.size(),0);
+    int used=t.check.size();
+    while(used>1 && t.check[used-1]==-1) used--;
+    t.base.resize(used); t.check.resize(used);
+    t.child.resize(used); t.sib.resize(used);
+    for(auto b:{&t.endBit,&t.kidBit,&t.sibBit}) b->resize((used+63)/64);
+    t.base.shrink_to_fit(); t.check.shrink_to_fit();
+    t.child.shrink_to_fit(); t.sib.shrink_to_fit();
+    return t;
+}
+
+size_t daBytes(const DATrie &t){
+    return t.base.capacity()*4+t.check.capacity()*4+t.child.capacity()+t.sib.capacity()
+        +(t.endBit.capacity()+t.kidBit.capacity()+t.sibBit.capacity())*8;
+}
+
+int daWalk(const DATrie &t,string_view s){
+    int cur=0, n=t.base.size();
+    for(char c:s){
+        int nx=t.base[cur]+(unsigned char)c;
+        if(nx>=n || t.check[nx]!=cur) return -1;
+        cur=nx;
+    }
+    return cur;
+}
+
+bool searchTrie(const DATrie &t,string_view s){
+    int cur=daWalk(t,s);
+    return cur>=0 && getBit(t.endBit,cur);
+}
+
+void autoComplete(const DATrie &t,string pref,vector<string>&res){
+    int cur=daWalk(t,pref);
+    if(cur<0) return;
+    vector<int> st={cur};
+    vector<int> len={(int)pref.size()};
+    while(!st.empty()){
+        int u=st.back(), l=len.back();
+        st.pop_back(); len.pop_back();
+        pref.resize(l);
+        if(u!=cur) pref+=char(u-t.base[t.check[u]]);
+        if(getBit(t.endBit,u)) res.push_back(pref);
+        if(u!=cur && getBit(t.sibBit,u)){
+            st.push_back(t.base[t.check[u]]+t.sib[u]);
+            len.push_back(l);
+        }
+        if(getBit(t.kidBit,u)){
+            st.push_back(t.base[u]+t.child[u]);
+            len.push_back(pref.size());
+        }
+    }
+}
+
+struct CNode {
+    bool end=false;
+    vector<unsigned char> lab;
+    vector<CNode*> kid;
+};
+
+struct alignas(64) EpochSlot {
+    atomic<uint64_t> e{0};
+};
+
+struct RcuTrie {
+    atomic<CNode*> root;
+    atomic<uint64_t> epoch{1};
+    vector<EpochSlot> slots;
+    vector<pair<uint64_t,CNode*>> retired;
+    size_t freed=0;
+
+    RcuTrie(int readers):root(new CNode()),slots(readers){}
+
+    ~RcuTrie(){
+        freeTree(root.load());
+        for(auto &r:retired) delete r.second;
+    }
+
+    void freeTree(CNode* n){
+        for(CNode* k:n->kid) freeTree(k);
+        delete n;
+    }
+
+    static int findKid(const CNode* n,unsigned char c){
+        auto it=lower_bound(n->lab.begin(),n->lab.end(),c);
+        return it!=n->lab.end() && *it==c ? it-n->lab.begin() : -1;
+    }
+
+    CNode* copyInsert(CNode* old,string_view s,size_t d,vector<CNode*>&garbage){
+        CNode* n=old?new CNode(*old):new CNode();
+        if(old) garbage.push_back(old);
+        if(d==s.size()){
+            n->end=true;
+            return n;
+        }
+        unsigned char c=s[d];
+        int i=findKid(n,c);
+        if(i>=0) n->kid[i]=copyInsert(n->kid[i],s,d+1,garbage);
+        else {
+            int at=lower_bound(n->lab.begin(),n->lab.end(),c)-n->lab.begin();
+            n->lab.insert(n->lab.begin()+at,c);
+            n->kid.insert(n->kid.begin()+at,copyInsert(NULL,s,d+1,garbage));
+        }
+        return n;
+    }
+
+    // single writer: copy the path, publish the new root, retire the old path
+    void insert(string_view s){
+        CNode* old=root.load();
+        const CNode* cur=old;
+        size_t d=0;
+        while(d<s.size()){
+            int i=findKid(cur,s[d]);
+            if(i<0) break;
+            cur=cur->kid[i];
+            d++;
+        }
+        if(d==s.size() && cur->end) return;
+        vector<CNode*> garbage;
+        CNode* nr=copyInsert(old,s,0,garbage);
+        root.store(nr);
+        uint64_t r=epoch.fetch_add(1);
+        for(CNode* g:garbage) retired.push_back({r,g});
+        if(retired.size()>=1024) reclaim();
+    }
+
+    // nodes retired at epoch r are unreachable once every reader has left r
+    void reclaim(){
+        uint64_t low=UINT64_MAX;
+        for(auto &sl:slots){
+            uint64_t v=sl.e.load();
+            if(v) low=min(low,v);
+        }
+        size_t k=0;
+        for(auto &r:retired){
+            if(r.first<low){
+                delete r.second;
+                freed++;
+            } else retired[k++]=r;
+        }
+        retired.resize(k);
+    }
+
+    struct ReadGuard {
+        EpochSlot &sl;
+        const CNode* snap;
+        ReadGuard(RcuTrie &t,int slot):sl(t.slots[slot]){
+            sl.e.store(t.epoch.load());
+            snap=t.root.load();
+        }
+        ~ReadGuard(){ sl.e.store(0); }
+    };
+
+    bool search(int slot,string_view s){
+        ReadGuard g(*this,slot);
+        const CNode* cur=g.snap;
+        for(char c:s){
+            int i=findKid(cur,c);
+            if(i<0) return false;
+            cur=cur->kid[i];
+        }
+        return cur->end;
+    }
+
+    void autoComplete(int slot,string pref,vector<string>&res){
+        ReadGuard g(*this,slot);
+        const CNode* cur=g.snap;
+        for(char c:pref){
+            int i=findKid(cur,c);
+            if(i<0) return;
+            cur=cur->kid[i];
+        }
+        collect(cur,pref,res);
+    }
+
+    static void collect(const CNode* n,string &pref,vector<string>&res){
+        if(n->end) res.push_back(pref);
+        for(size_t i=0;i<n->lab.size();i++){
+            pref.push_back(n->lab[i]);
+            collect(n->kid[i],pref,res);
+            pref.pop_back();
+        }
+    }
+};
+
+uint64_t hashKey(string_view s){
+    uint64_t h=1469598103934665603ULL;
+    for(char c:s) h=(h^(unsigned char)c)*1099511628211ULL;
+    return h;
 }
 
-unordered_map<string,string> dataStore;
+struct SwissStore {
+    static constexpr int8_t EMPTY=-128,DELETED=-2;
+    static constexpr int INLINE=20;
+    struct Slot {
+        uint64_t key;
+        uint32_t len;
+        char in[INLINE];
+    };
+    vector<int8_t> ctrl;
+    vector<Slot> slots;
+    string heap;
+    size_t cnt=0,tomb=0,mask=0,dead=0;
+
+    SwissStore(size_t n=0){ rehash(groupsFor(n)); }
+
+    static uint64_t mix(uint64_t k){
+        k^=k>>33; k*=0xff51afd7ed558ccdULL;
+        k^=k>>33; k*=0xc4ceb9fe1a85ec53ULL;
+        return k^(k>>33);
+    }
+    static size_t groupsFor(size_t n){
+        size_t g=1;
+        while(g*16*7/8<n) g*=2;
+        return g;
+    }
+    static uint32_t match(const int8_t* c,int8_t t){
+#ifdef __SSE2__
+        __m128i g=_mm_loadu_si128((const __m128i*)c);
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(g,_mm_set1_epi8(t)));
+#else
+        uint32_t m=0;
+        for(int i=0;i<16;i++) if(c[i]==t) m|=1u<<i;
+        return m;
+#endif
+    }
+    static uint32_t matchFree(const int8_t* c){
+#ifdef __SSE2__
+        return _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)c));
+#else
+        uint32_t m=0;
+        for(int i=0;i<16;i++) if(c[i]<0) m|=1u<<i;
+        return m;
+#endif
+    }
+
+    size_t find(uint64_t k) const{
+        uint64_t h=mix(k);
+        int8_t t=h&0x7F;
+        size_t g=(h>>7)&mask;
+        for(size_t step=1;;step++){
+            const int8_t* c=&ctrl[g*16];
+            for(uint32_t m=match(c,t);m;m&=m-1){
+                size_t s=g*16+__builtin_ctz(m);
+                if(slots[s].key==k) return s;
+            }
+            if(match(c,EMPTY)) return SIZE_MAX;
+            g=(g+step)&mask;
+        }
+    }
+    size_t freeSlot(uint64_t h) const{
+        size_t g=(h>>7)&mask;
+        for(size_t step=1;;step++){
+            uint32_t m=matchFree(&ctrl[g*16]);
+            if(m) return g*16+__builtin_ctz(m);
+            g=(g+step)&mask;
+        }
+    }
+    void rehash(size_t groups){
+        vector<int8_t> oc(groups*16,EMPTY);
+        vector<Slot> os(groups*16);
+        swap(oc,ctrl); swap(os,slots);
+        mask=groups-1; tomb=0;
+        for(size_t i=0;i<oc.size();i++){
+            if(oc[i]<0) continue;
+            uint64_t h=mix(os[i].key);
+            size_t s=freeSlot(h);
+            ctrl[s]=h&0x7F;
+            slots[s]=os[i];
+        }
+    }
+    void reserve(size_t n){
+        if(groupsFor(n)>mask+1) rehash(groupsFor(n));
+    }
+    static uint64_t offsetOf(const Slot &sl){
+        uint64_t off;
+        memcpy(&off,sl.in,sizeof off);
+        return off;
+    }
+    void compact(){
+        string h;
+        h.reserve(heap.size()-dead);
+        for(size_t i=0;i<slots.size();i++){
+            if(ctrl[i]<0 || slots[i].len<=INLINE) continue;
+            uint64_t off=h.size();
+            h.append(heap,offsetOf(slots[i]),slots[i].len);
+            memcpy(slots[i].in,&off,sizeof off);
+        }
+        heap.swap(h);
+        dead=0;
+    }
+    void setValue(Slot &sl,string_view v){
+        sl.len=v.size();
+        if(v.size()<=INLINE){ memmove(sl.in,v.data(),v.size()); return; }
+        uint64_t off=heap.size();
+        heap.append(v.data(),v.size());
+        memcpy(sl.in,&off,sizeof off);
+    }
+    void put(uint64_t k,string_view v){
+        size_t s=find(k);
+        if(s!=SIZE_MAX){
+            Slot &sl=slots[s];
+            if(sl.len>INLINE && v.size()>INLINE && v.size()<=sl.len){
+                memmove(&heap[offsetOf(sl)],v.data(),v.size());
+                dead+=sl.len-v.size();
+                sl.len=v.size();
+            }
+            else {
+                if(sl.len>INLINE) dead+=sl.len;
+                setValue(sl,v);
+            }
+            if(dead*2>heap.size()) compact();
+            return;
+        }
+        if((cnt+tomb+1)*8>slots.size()*7) rehash(cnt*16>=slots.size()*7?(mask+1)*2:mask+1);
+        uint64_t h=mix(k);
+        s=freeSlot(h);
+        if(ctrl[s]==DELETED) tomb--;
+        ctrl[s]=h&0x7F;
+        slots[s].key=k;
+        setValue(slots[s],v);
+        cnt++;
+    }
+    bool get(uint64_t k,string_view &v) const{
+        size_t s=find(k);
+        if(s==SIZE_MAX) return false;
+        const Slot &sl=slots[s];
+        if(sl.len<=INLINE) v=string_view(sl.in,sl.len);
+        else v=string_view(heap.data()+offsetOf(sl),sl.len);
+        return true;
+    }
+    bool erase(uint64_t k){
+        size_t s=find(k);
+        if(s==SIZE_MAX) return false;
+        ctrl[s]=DELETED;
+        cnt--; tomb++;
+        if(slots[s].len>INLINE){
+            dead+=slots[s].len;
+            if(dead*2>heap.size()) compact();
+        }
+        return true;
+    }
+    void bulkLoad(const vector<pair<uint64_t,string_view>>&kv){
+        reserve(cnt+kv.size());
+        size_t big=0;
+        for(auto &p:kv) if(p.second.size()>INLINE) big+=p.second.size();
+        heap.reserve(heap.size()+big);
+        for(auto &p:kv) put(p.first,p.second);
+    }
+    size_t size() const{ return cnt; }
+    double loadFactor() const{ return (double)cnt/slots.size(); }
+    size_t bytes() const{ return ctrl.size()+slots.size()*sizeof(Slot)+heap.capacity(); }
+};
+
+SwissStore dataStore;
 
 void mergeArr(vector<string>&a,int l,int m,int r){
     int n1=m-l+1,n2=r-m;
@@ -90,6 +562,148 @@ void quickSort(vector<string>&a,int l,int r){
     }
 }
 
+int charAt(string_view s,size_t d){
+    return d<s.size()?(unsigned char)s[d]:-1;
+}
+
+void mkqsort(string_view* a,size_t n,size_t d){
+    while(n>16){
+        int x=charAt(a[0],d),y=charAt(a[n/2],d),z=charAt(a[n-1],d);
+        int v=max(min(x,y),min(max(x,y),z));
+        size_t lt=0,i=0,gt=n;
+        while(i<gt){
+            int c=charAt(a[i],d);
+            if(c<v) swap(a[lt++],a[i++]);
+            else if(c>v) swap(a[i],a[--gt]);
+            else i++;
+        }
+        mkqsort(a,lt,d);
+        mkqsort(a+gt,n-gt,d);
+        if(v<0) return;
+        a+=lt; n=gt-lt; d++;
+    }
+    for(size_t i=1;i<n;i++){
+        string_view t=a[i];
+        size_t j=i;
+        while(j>0 && t.substr(d)<a[j-1].substr(d)){ a[j]=a[j-1]; j--; }
+        a[j]=t;
+    }
+}
+
+void msdRadix(string_view* a,string_view* tmp,uint16_t* key,size_t n,size_t d){
+    struct Frame { string_view* a; size_t n,d; };
+    vector<Frame> st={{a,n,d}};
+    size_t cnt[257],pos[257];
+    while(!st.empty()){
+        Frame f=st.back();
+        st.pop_back();
+        if(f.n<64){ mkqsort(f.a,f.n,f.d); continue; }
+        fill(cnt,cnt+257,0);
+        for(size_t i=0;i<f.n;i++){
+            key[i]=charAt(f.a[i],f.d)+1;
+            cnt[key[i]]++;
+        }
+        if(cnt[key[0]]==f.n){
+            if(key[0]) st.push_back({f.a,f.n,f.d+1});
+            continue;
+        }
+        pos[0]=0;
+        for(int c=1;c<257;c++) pos[c]=pos[c-1]+cnt[c-1];
+        for(size_t i=0;i<f.n;i++) tmp[pos[key[i]]++]=f.a[i];
+        copy(tmp,tmp+f.n,f.a);
+        size_t s=cnt[0];
+        for(int c=1;c<257;c++){
+            if(cnt[c]>1) st.push_back({f.a+s,cnt[c],f.d+1});
+            s+=cnt[c];
+        }
+    }
+}
+
+void msdRadixSort(string_view* a,size_t n){
+    vector<string_view> tmp(n);
+    vector<uint16_t> key(n);
+    msdRadix(a,tmp.data(),key.data(),n,0);
+}
+
+void multikeyQuickSort(string_view* a,size_t n){
+    mkqsort(a,n,0);
+}
+
+uint32_t lcpFrom(string_view a,string_view b,size_t h){
+    size_t m=min(a.size(),b.size());
+    while(h<m && a[h]==b[h]) h++;
+    return h;
+}
+
+void lcpMerge(const string_view* a,const uint32_t* la,size_t na,const string_view* b,const uint32_t* lb,size_t nb,
+              string_view* out,uint32_t* lo){
+    size_t i=0,j=0,k=0;
+    uint32_t ha=0,hb=0;
+    while(i<na && j<nb){
+        if(ha>hb){
+            lo[k]=ha; out[k++]=a[i++];
+            if(i<na) ha=la[i];
+        } else if(ha<hb){
+            lo[k]=hb; out[k++]=b[j++];
+            if(j<nb) hb=lb[j];
+        } else {
+            uint32_t h=lcpFrom(a[i],b[j],ha);
+            if(charAt(a[i],h)<=charAt(b[j],h)){
+                lo[k]=ha; out[k++]=a[i++];
+                hb=h;
+                if(i<na) ha=la[i];
+            } else {
+                lo[k]=hb; out[k++]=b[j++];
+                ha=h;
+                if(j<nb) hb=lb[j];
+            }
+        }
+    }
+    if(i<na){ lo[k]=ha; out[k++]=a[i++]; }
+    while(i<na){ lo[k]=la[i]; out[k++]=a[i++]; }
+    if(j<nb){ lo[k]=hb; out[k++]=b[j++]; }
+    while(j<nb){ lo[k]=lb[j]; out[k++]=b[j++]; }
+}
+
+void stringSort(vector<string_view>&a,int threads){
+    size_t n=a.size();
+    threads=max<size_t>(1,min<size_t>(threads,n/4096));
+    if(threads==1){ msdRadixSort(a.data(),n); return; }
+    vector<size_t> cut(threads+1);
+    for(int t=0;t<=threads;t++) cut[t]=n*t/threads;
+    vector<string_view> buf(n);
+    vector<uint32_t> lcp(n),lcpBuf(n);
+    vector<thread> pool;
+    for(int t=0;t<threads;t++){
+        pool.emplace_back([&,t](){
+            size_t l=cut[t],r=cut[t+1];
+            msdRadixSort(a.data()+l,r-l);
+            lcp[l]=0;
+            for(size_t i=l+1;i<r;i++) lcp[i]=lcpFrom(a[i-1],a[i],0);
+        });
+    }
+    for(auto &t:pool) t.join();
+    string_view *src=a.data(),*dst=buf.data();
+    uint32_t *ls=lcp.data(),*ld=lcpBuf.data();
+    while(cut.size()>2){
+        vector<size_t> nc;
+        pool.clear();
+        for(size_t r=0;r+1<cut.size();r+=2){
+            nc.push_back(cut[r]);
+            size_t l=cut[r],m=cut[r+1],e=r+2<cut.size()?cut[r+2]:m;
+            pool.emplace_back([=](){
+                lcpMerge(src+l,ls+l,m-l,src+m,ls+m,e-m,dst+l,ld+l);
+            });
+        }
+        nc.push_back(n);
+        for(auto &t:pool) t.join();
+        cut=nc;
+        swap(src,dst);
+        swap(ls,ld);
+    }
+    if(src!=a.data()) copy(src,src+n,a.data());
+}
+
 vector<int> buildLPS(string p){
     vector<int>l(p.size(),0);
     int i=1,k=0;
@@ -149,31 +763,639 @@ string randomRecord(){
     return s;
 }
 
-int main(){
+int countNodes(Trie* cur){
+    int c=1;
+    for(int i=0;i<256;i++)
+        if(cur->child[i]) c+=countNodes(cur->child[i]);
+    return c;
+}
+
+string randomKey(){
+    vector<string> w={"population","traffic","sensor","energy","health","crime","water","land"};
+    string s=w[rand()%w.size()];
+    int L=rand()%10+4;
+    for(int i=0;i<L;i++) s+=char('a'+rand()%26);
+    return s;
+}
+
+double since(chrono::steady_clock::time_point t0){
+    return chrono::duration<double>(chrono::steady_clock::now()-t0).count();
+}
+
+void benchTrie(int n){
+    vector<string> keys(n);
+    for(auto &k:keys) k=randomKey();
+    auto t0=chrono::steady_clock::now();
+    DATrie da=buildDATrie(keys);
+    double bt=since(t0);
+    cout<<"keys "<<n<<" nodes "<<da.nodes<<" slots "<<da.base.size()<<"\n";
+    cout<<"double-array build "<<bt<<"s "<<daBytes(da)/1048576.0<<" MB "<<(double)daBytes(da)/da.nodes<<" bytes/node\n";
+    vector<string> q(1000000);
+    for(size_t i=0;i<q.size();i++) q[i]=i%2?keys[rand()%n]:randomKey();
+    t0=chrono::steady_clock::now();
+    int hit=0;
+    for(auto &s:q) hit+=searchTrie(da,s);
+    double dt=since(t0);
+    cout<<"double-array lookup "<<dt/q.size()*1e9<<" ns "<<hit<<" hits\n";
+    t0=chrono::steady_clock::now();
+    size_t cnt=0;
+    for(int i=0;i<1000;i++){
+        vector<string> res;
+        autoComplete(da,keys[i].substr(0,keys[i].size()-3),res);
+        cnt+=res.size();
+    }
+    cout<<"double-array prefix enumeration "<<since(t0)/1000*1e6<<" us "<<cnt<<" results\n";
+    size_t ptrBytes=(size_t)da.nodes*sizeof(Trie);
+    if(ptrBytes>(1ULL<<31)){
+        cout<<"pointer trie skipped, needs "<<ptrBytes/1048576<<" MB\n";
+        return;
+    }
+    rootTrie=new Trie();
+    t0=chrono::steady_clock::now();
+    for(auto &k:keys) insertTrie(k);
+    bt=since(t0);
+    cout<<"pointer trie build "<<bt<<"s "<<ptrBytes/1048576.0<<" MB "<<sizeof(Trie)<<" bytes/node\n";
+    t0=chrono::steady_clock::now();
+    hit=0;
+    for(auto &s:q) hit+=searchTrie(s);
+    dt=since(t0);
+    cout<<"pointer trie lookup "<<dt/q.size()*1e9<<" ns "<<hit<<" hits\n";
+    t0=chrono::steady_clock::now();
+    cnt=0;
+    for(int i=0;i<1000;i++){
+        vector<string> res;
+        string pre=keys[i].substr(0,keys[i].size()-3);
+        Trie* cur=rootTrie;
+        for(char c:pre) cur=cur->child[(unsigned char)c];
+        autoComplete(cur,pre,res);
+        cnt+=res.size();
+    }
+    cout<<"pointer trie prefix enumeration "<<since(t0)/1000*1e6<<" us "<<cnt<<" results\n";
+    freeTrie(rootTrie);
+    rootTrie=NULL;
+}
+
+void benchRcu(int readers,double secs){
+    vector<string> keys(100000);
+    for(size_t i=0;i<keys.size();i++) keys[i]=randomRecord().substr(0,8)+to_string(i);
+    int preload=keys.size()/2;
+    for(int mode=0;mode<2;mode++){
+        RcuTrie rt(readers);
+        shared_mutex mu;
+        rootTrie=new Trie();
+        for(int i=0;i<preload;i++){
+            if(mode==0) rt.insert(keys[i]);
+            else insertTrie(keys[i]);
+        }
+        atomic<bool> stop(false);
+        atomic<long long> reads(0);
+        long long writes=0;
+        double writeTime=0;
+        vector<thread> pool;
+        for(int r=0;r<readers;r++){
+            pool.emplace_back([&,r](){
+                mt19937 rng(r);
+                long long cnt=0;
+                vector<string> res;
+                while(!stop.load(memory_order_relaxed)){
+                    const string &k=keys[rng()%preload];
+                    if(mode==0){
+                        if(cnt%16==0){ res.clear(); rt.autoComplete(r,k.substr(0,10),res); }
+                        else rt.search(r,k);
+                    } else {
+                        shared_lock<shared_mutex> lk(mu);
+                        if(cnt%16==0){
+                            res.clear();
+                            Trie* cur=rootTrie;
+                            for(char c:k.substr(0,10)) if(cur) cur=cur->child[(unsigned char)c];
+                            if(cur) autoComplete(cur,k.substr(0,10),res);
+                        } else searchTrie(k);
+                    }
+                    cnt++;
+                }
+                reads+=cnt;
+            });
+        }
+        auto t0=chrono::steady_clock::now();
+        thread writer([&](){
+            for(size_t i=preload;i<keys.size() && !stop.load(memory_order_relaxed);i++){
+                if(mode==0) rt.insert(keys[i]);
+                else {
+                    unique_lock<shared_mutex> lk(mu);
+                    insertTrie(keys[i]);
+                }
+                writes++;
+            }
+            writeTime=since(t0);
+        });
+        this_thread::sleep_for(chrono::duration<double>(secs));
+        stop=true;
+        writer.join();
+        for(auto &t:pool) t.join();
+        double el=since(t0);
+        cout<<(mode==0?"rcu trie":"shared_mutex pointer trie")<<" readers "<<readers<<" reads/s "<<reads/el
+            <<" writes/s "<<writes/writeTime;
+        if(mode==0){
+            rt.reclaim();
+            cout<<" freed "<<rt.freed<<" pending "<<rt.retired.size();
+        }
+        cout<<"\n";
+        freeTrie(rootTrie);
+        rootTrie=NULL;
+    }
+}
+
+size_t readFull(int fd,char* p,size_t n){
+    size_t got=0;
+    while(got<n){
+        ssize_t r=::read(fd,p+got,n-got);
+        if(r<0 && errno==EINTR) continue;
+        if(r<0) throw runtime_error("read failed");
+        if(!r) break;
+        got+=r;
+    }
+    return got;
+}
+
+void writeFull(int fd,const char* p,size_t n){
+    while(n){
+        ssize_t w=::write(fd,p,n);
+        if(w<=0) throw runtime_error("write failed");
+        p+=w; n-=w;
+    }
+}
+
+void moveFile(const string& from,const string& to){
+    if(!rename(from.c_str(),to.c_str())) return;
+    if(errno!=EXDEV) throw runtime_error("cannot rename "+from+" to "+to);
+    int in=::open(from.c_str(),O_RDONLY);
+    if(in<0) throw runtime_error("cannot open "+from);
+    int out=::open(to.c_str(),O_WRONLY|O_CREAT|O_TRUNC,0644);
+    if(out<0){ ::close(in); throw runtime_error("cannot create "+to); }
+    vector<char> buf(1<<20);
+    try {
+        while(size_t n=readFull(in,buf.data(),buf.size())) writeFull(out,buf.data(),n);
+    } catch(...){
+        ::close(in); ::close(out);
+        throw;
+    }
+    ::close(in);
+    if(::close(out)) throw runtime_error("cannot write "+to);
+    remove(from.c_str());
+}
+
+struct RunReader {
+    int fd=-1;
+    size_t cap;
+    vector<char> buf[2];
+    size_t len=0,pos=0;
+    int cur=0;
+    bool done=false;
+    future<size_t> nxt;
+    string spill;
+    RunReader(string path,size_t cap):cap(cap){
+        fd=::open(path.c_str(),O_RDONLY);
+        if(fd<0) throw runtime_error("cannot open "+path);
+        buf[0].resize(cap); buf[1].resize(cap);
+        len=readFull(fd,buf[0].data(),cap);
+        prefetch();
+    }
+    ~RunReader(){
+        if(nxt.valid()) nxt.wait();
+        if(fd>=0) ::close(fd);
+    }
+    void prefetch(){
+        char* p=buf[cur^1].data();
+        nxt=async(launch::async,[this,p](){ return readFull(fd,p,cap); });
+    }
+    bool refill(){
+        if(done) return false;
+        len=nxt.get(); pos=0; cur^=1;
+        if(!len){ done=true; return false; }
+        prefetch();
+        return true;
+    }
+    bool next(string_view &rec){
+        spill.clear();
+        bool part=false;
+        for(;;){
+            if(pos==len && !refill()){
+                rec=spill;
+                return part;
+            }
+            char* b=buf[cur].data()+pos;
+            char* nl=(char*)memchr(b,'\n',len-pos);
+            if(nl){
+                pos+=nl-b+1;
+                if(!part){ rec=string_view(b,nl-b); return true; }
+                spill.append(b,nl-b);
+                rec=spill;
+                return true;
+            }
+            spill.append(b,len-pos);
+            pos=len; part=true;
+        }
+    }
+};
+
+struct RunWriter {
+    int fd;
+    size_t cap,len=0;
+    vector<char> buf[2];
+    int cur=0;
+    future<void> pend;
+    long long bytes=0;
+    RunWriter(string path,size_t cap):cap(cap){
+        fd=::open(path.c_str(),O_WRONLY|O_CREAT|O_TRUNC,0644);
+        if(fd<0) throw runtime_error("cannot create "+path);
+        buf[0].resize(cap); buf[1].resize(cap);
+    }
+    void put(string_view r){
+        bytes+=r.size()+1;
+        if(len+r.size()+1>cap) flush();
+        if(r.size()+1>cap){
+            if(pend.valid()) pend.get();
+            writeFull(fd,r.data(),r.size());
+            writeFull(fd,"\n",1);
+            return;
+        }
+        char* p=buf[cur].data()+len;
+        memcpy(p,r.data(),r.size());
+        p[r.size()]='\n';
+        len+=r.size()+1;
+    }
+    void flush(){
+        if(pend.valid()) pend.get();
+        if(!len) return;
+        const char* p=buf[cur].data();
+        size_t n=len;
+        pend=async(launch::async,[this,p,n](){ writeFull(fd,p,n); });
+        cur^=1; len=0;
+    }
+    void close(){
+        flush();
+        if(pend.valid()) pend.get();
+        ::close(fd);
+    }
+};
+
+struct LoserTree {
+    int k;
+    vector<int> t;
+    vector<string_view> key;
+    vector<char> live;
+    LoserTree(int k):k(k),t(k),key(k),live(k,0){}
+    bool less(int a,int b){
+        if(!live[a]) return false;
+        if(!live[b]) return true;
+        return key[a]<key[b];
+    }
+    int build(int n){
+        if(n>=k) return n-k;
+        int a=build(2*n),b=build(2*n+1);
+        if(less(b,a)) swap(a,b);
+        t[n]=b;
+        return a;
+    }
+    void init(){ t[0]=build(1); }
+    void replay(int i){
+        int w=i;
+        for(int n=(i+k)/2;n>=1;n/=2)
+            if(less(t[n],w)) swap(t[n],w);
+        t[0]=w;
+    }
+};
+
+struct ExtSortStats {
+    long long bytes=0,records=0;
+    int runs=0,passes=0;
+    double genSec=0,mergeSec=0;
+    vector<double> passSec;
+};
+
+long long mergeRuns(const vector<string>&in,string out,size_t cap){
+    int k=in.size();
+    vector<unique_ptr<RunReader>> rd;
+    for(auto &p:in) rd.emplace_back(new RunReader(p,cap));
+    RunWriter w(out,cap);
+    LoserTree lt(k);
+    for(int i=0;i<k;i++) lt.live[i]=rd[i]->next(lt.key[i]);
+    lt.init();
+    long long cnt=0;
+    while(lt.live[lt.t[0]]){
+        int i=lt.t[0];
+        w.put(lt.key[i]);
+        cnt++;
+        lt.live[i]=rd[i]->next(lt.key[i]);
+        lt.replay(i);
+    }
+    w.close();
+    return cnt;
+}
+
+ExtSortStats externalSort(string inPath,string outPath,size_t budget,int threads,string tmpDir="."){
+    ExtSortStats st;
+    threads=max(1,threads);
+    string prefix=tmpDir+"/extsort"+to_string(getpid())+"_";
+    int inFd=::open(inPath.c_str(),O_RDONLY);
+    if(inFd<0) throw runtime_error("cannot open "+inPath);
+    size_t share=max<size_t>(budget/threads,1<<21);
+    size_t ioCap=max<size_t>(share/16,1<<16);
+    size_t chunk=share-2*ioCap;
+    const size_t perRec=2*sizeof(string_view)+sizeof(uint16_t);
+    size_t fill=max<size_t>(chunk/(1+perRec),1<<16);
+    mutex mu;
+    string carry;
+    bool inDone=false;
+    vector<string> runs;
+    atomic<long long> recs(0);
+    auto t0=chrono::steady_clock::now();
+    auto work=[&](){
+        vector<char> buf;
+        vector<string_view> v;
+        for(;;){
+            string path;
+            {
+                lock_guard<mutex> lk(mu);
+                if(inDone && carry.empty()) return;
+                buf.resize(max(fill,carry.size())+1);
+                memcpy(buf.data(),carry.data(),carry.size());
+                size_t n=carry.size();
+                carry.clear();
+                size_t cut;
+                for(;;){
+                    if(!inDone){
+                        size_t want=buf.size()-1-n;
+                        size_t got=readFull(inFd,buf.data()+n,want);
+                        n+=got;
+                        if(got<want) inDone=true;
+                    }
+                    if(inDone){
+                        if(n && buf[n-1]!='\n') buf[n++]='\n';
+                        cut=n;
+                        break;
+                    }
+                    char* e=buf.data()+n;
+                    while(e>buf.data() && e[-1]!='\n') e--;
+                    if(e>buf.data()){ cut=e-buf.data(); break; }
+                    buf.resize(buf.size()*2);
+                }
+                v.clear();
+                size_t used=0;
+                for(char *p=buf.data(),*e=p+cut;p<e;){
+                    char* nl=(char*)memchr(p,'\n',e-p);
+                    size_t cost=nl-p+1+perRec;
+                    if(!v.empty() && used+cost>chunk) break;
+                    v.emplace_back(p,nl-p);
+                    used+=cost;
+                    p=nl+1;
+                }
+                size_t text=used-v.size()*perRec;
+                carry.assign(buf.data()+text,n-text);
+                if(v.empty()) continue;
+                fill=max<size_t>(chunk*((double)text/used),1<<16);
+                path=prefix+to_string(runs.size());
+                runs.push_back(path);
+            }
+            msdRadixSort(v.data(),v.size());
+            RunWriter w(path,ioCap);
+            for(auto &r:v) w.put(r);
+            w.close();
+            recs+=v.size();
+        }
+    };
+    exception_ptr err;
+    vector<thread> pool;
+    for(int i=0;i<threads;i++) pool.emplace_back([&](){
+        try { work(); }
+        catch(...){
+            lock_guard<mutex> lk(mu);
+            if(!err) err=current_exception();
+        }
+    });
+    for(auto &t:pool) t.join();
+    ::close(inFd);
+    if(err){
+        for(auto &p:runs) remove(p.c_str());
+        rethrow_exception(err);
+    }
+    st.genSec=since(t0);
+    st.records=recs;
+    st.runs=runs.size();
+    struct stat sb;
+    if(stat(inPath.c_str(),&sb)==0) st.bytes=sb.st_size;
+    size_t cap=1<<20;
+    int fan=max<long long>(2,(long long)(budget/(2*cap))-1);
+    if(fan>(int)runs.size()) cap=max<size_t>(budget/(2*(runs.size()+1)),1<<16);
+    if(runs.empty()) RunWriter(outPath,1).close();
+    int gen=0;
+    auto m0=chrono::steady_clock::now();
+    while(runs.size()>1){
+        auto p0=chrono::steady_clock::now();
+        vector<string> nextRuns;
+        for(size_t i=0;i<runs.size();i+=fan){
+            vector<string> grp(runs.begin()+i,runs.begin()+min(runs.size(),i+fan));
+            if(grp.size()==1){ nextRuns.push_back(grp[0]); continue; }
+            string out=runs.size()<=(size_t)fan?outPath:prefix+"m"+to_string(gen++);
+            mergeRuns(grp,out,cap);
+            for(auto &p:grp) remove(p.c_str());
+            nextRuns.push_back(out);
+        }
+        runs=nextRuns;
+        st.passes++;
+        st.passSec.push_back(since(p0));
+    }
+    if(runs.size()==1 && runs[0]!=outPath){
+        try { moveFile(runs[0],outPath); }
+        catch(...){ remove(runs[0].c_str()); throw; }
+    }
+    st.mergeSec=since(m0);
+    return st;
+}
+
+void benchExtSort(int mb,int budgetMb){
+    string in="extsort_in.txt",out="extsort_out.txt";
+    {
+        RunWriter w(in,1<<22);
+        while(w.bytes<((long long)mb<<20)) w.put(randomRecord());
+        w.close();
+    }
+    int th=max(1u,thread::hardware_concurrency());
+    ExtSortStats st=externalSort(in,out,(size_t)budgetMb<<20,th);
+    double sz=st.bytes/1048576.0;
+    cout<<"external sort "<<sz<<" MB "<<st.records<<" records budget "<<budgetMb<<" MB threads "<<th<<"\n";
+    cout<<"run generation "<<st.genSec<<" s "<<sz/st.genSec<<" MB/s "<<st.runs<<" runs\n";
+    for(int i=0;i<st.passes;i++) cout<<"merge pass "<<i+1<<" "<<st.passSec[i]<<" s "<<sz/st.passSec[i]<<" MB/s\n";
+    cout<<"total "<<st.genSec+st.mergeSec<<" s "<<sz/(st.genSec+st.mergeSec)<<" MB/s\n";
+    long long cnt=0;
+    bool ok=true;
+    {
+        RunReader r(out,1<<22);
+        string prev;
+        string_view v;
+        while(r.next(v)){
+            if(cnt && v<prev) ok=false;
+            prev.assign(v.data(),v.size());
+            cnt++;
+        }
+    }
+    cout<<(ok && cnt==st.records?"output sorted":"output NOT sorted")<<"\n";
+    remove(in.c_str());
+    remove(out.c_str());
+}
+
+void benchStringSort(int n,int threads){
+    string pool;
+    vector<size_t> off(n+1,0);
+    for(int i=0;i<n;i++){
+        pool+=randomRecord();
+        off[i+1]=pool.size();
+    }
+    vector<string_view> keys(n);
+    for(int i=0;i<n;i++) keys[i]=string_view(pool).substr(off[i],off[i+1]-off[i]);
+    cout<<"string sort "<<n<<" keys "<<pool.size()/1048576.0<<" MB threads "<<threads<<"\n";
+    vector<string_view> ref=keys;
+    auto t0=chrono::steady_clock::now();
+    sort(ref.begin(),ref.end());
+    cout<<"std::sort string_view "<<since(t0)<<" s\n";
+    auto run=[&](string name,auto fn){
+        vector<string_view> v=keys;
+        auto t0=chrono::steady_clock::now();
+        fn(v);
+        cout<<name<<" "<<since(t0)<<" s"<<(v==ref?"":" MISMATCH")<<"\n";
+    };
+    run("msd radix",[](vector<string_view>&v){ msdRadixSort(v.data(),v.size()); });
+    run("multikey quicksort",[](vector<string_view>&v){ multikeyQuickSort(v.data(),v.size()); });
+    run("parallel msd + lcp merge",[&](vector<string_view>&v){ stringSort(v,max(threads,2)); });
+    if(n<=2000000){
+        vector<string> strs(keys.begin(),keys.end());
+        auto t0=chrono::steady_clock::now();
+        mergeSort(strs,0,strs.size()-1);
+        cout<<"mergeSort vector<string> "<<since(t0)<<" s\n";
+    }
+}
+
+void checkStringSort(){
+    vector<string> strs(100,string(2500,'x'));
+    string pre(10000,'a');
+    for(int i=0;i<2000;i++) strs.push_back(pre+to_string(rand()%50)+(i%3?pre:""));
+    for(int i=0;i<2000;i++) strs.push_back(string(rand()%300,'b')+char('a'+rand()%3));
+    vector<string_view> keys(strs.begin(),strs.end()),ref=keys;
+    sort(ref.begin(),ref.end());
+    bool ok=true;
+    for(int t=0;t<3;t++){
+        vector<string_view> v=keys;
+        if(t==0) msdRadixSort(v.data(),v.size());
+        if(t==1) multikeyQuickSort(v.data(),v.size());
+        if(t==2) stringSort(v,2);
+        ok=ok && v==ref;
+    }
+    cout<<"string sort duplicates and long prefixes "<<(ok?"ok":"MISMATCH")<<"\n";
+}
+
+void benchStore(int n){
+    vector<string> vals(n);
+    vector<uint64_t> keys(n);
+    for(int i=0;i<n;i++){
+        string r=randomRecord();
+        vals[i]=r.substr(0,i%2?rand()%16+4:rand()%80+24);
+        keys[i]=hashKey("rec"+to_string(i));
+    }
+    cout<<"key-value store "<<n<<" records\n";
+    unordered_map<string,string> old;
+    auto t0=chrono::steady_clock::now();
+    for(int i=0;i<n;i++) old[to_string(hashKey("rec"+to_string(i)))]=vals[i];
+    cout<<"unordered_map<string,string> insert "<<since(t0)/n*1e9<<" ns/op\n";
+    SwissStore ss;
+    t0=chrono::steady_clock::now();
+    for(int i=0;i<n;i++) ss.put(keys[i],vals[i]);
+    cout<<"swiss store put "<<since(t0)/n*1e9<<" ns/op load "<<ss.loadFactor()<<"\n";
+    vector<pair<uint64_t,string_view>> kv(n);
+    for(int i=0;i<n;i++) kv[i]={keys[i],vals[i]};
+    SwissStore bulk;
+    t0=chrono::steady_clock::now();
+    bulk.bulkLoad(kv);
+    cout<<"swiss store bulk load "<<since(t0)/n*1e9<<" ns/op load "<<bulk.loadFactor()<<" "
+        <<bulk.bytes()/1048576.0<<" MB\n";
+    vector<int> order(n);
+    for(int i=0;i<n;i++) order[i]=(i*2654435761ULL)%n;
+    size_t sum=0;
+    t0=chrono::steady_clock::now();
+    for(int i:order){
+        auto it=old.find(to_string(hashKey("rec"+to_string(i))));
+        if(it!=old.end()) sum+=it->second.size();
+    }
+    cout<<"unordered_map lookup via hashKey string "<<since(t0)/n*1e9<<" ns/op\n";
+    size_t sum2=0;
+    t0=chrono::steady_clock::now();
+    for(int i:order){
+        string_view v;
+        if(bulk.get(hashKey("rec"+to_string(i)),v)) sum2+=v.size();
+    }
+    cout<<"swiss store lookup via hashKey "<<since(t0)/n*1e9<<" ns/op\n";
+    t0=chrono::steady_clock::now();
+    for(int i:order){
+        string_view v;
+        if(bulk.get(keys[i],v)) sum2+=v.size();
+    }
+    cout<<"swiss store lookup precomputed key "<<since(t0)/n*1e9<<" ns/op\n";
+    long long miss=0;
+    t0=chrono::steady_clock::now();
+    for(int i=0;i<n;i++){
+        string_view v;
+        miss+=!bulk.get(keys[i]^0x9e3779b97f4a7c15ULL,v);
+    }
+    cout<<"swiss store miss "<<since(t0)/n*1e9<<" ns/op "<<(sum*2==sum2 && miss==n?"ok":"MISMATCH")<<"\n";
+}
+
+int main(int argc,char** argv){
     srand(time(NULL));
 
+    if(argc>2 && string(argv[1])=="bench"){
+        string mode=argv[2];
+        int n=argc>3?stoi(argv[3]):1000000;
+        if(mode=="trie")
+            for(int k:{n/100,n/10,n}) benchTrie(k);
+        if(mode=="rcu")
+            for(int r:{1,2,4,8}) benchRcu(r,argc>4?stod(argv[4]):2);
+        if(mode=="strsort")
+            benchStringSort(n,argc>4?stoi(argv[4]):thread::hardware_concurrency());
+        if(mode=="strcheck")
+            checkStringSort();
+        if(mode=="store")
+            benchStore(n);
+        if(mode=="extsort")
+            benchExtSort(argc>3?stoi(argv[3]):1024,argc>4?stoi(argv[4]):256);
+        return 0;
+    }
+
     rootTrie=new Trie();
 
-    vector<string> dataset;
+    vector<string> dataset, prefixes;
     for(int i=0;i<20;i++){
         string rec=randomRecord();
         dataset.push_back(rec);
-        string key=hashKey("rec"+to_string(i));
-        dataStore[key]=rec;
+        dataStore.put(hashKey("rec"+to_string(i)),rec);
         insertTrie(rec.substr(0,5));
+        prefixes.push_back(rec.substr(0,5));
     }
 
+    DATrie daTrie=buildDATrie(prefixes);
+
     vector<string> sorted1 = dataset;
     vector<string> sorted2 = dataset;
 
     mergeSort(sorted1,0,sorted1.size()-1);
     quickSort(sorted2,0,sorted2.size()-1);
+    vector<string_view> sorted3(dataset.begin(),dataset.end());
+    stringSort(sorted3,thread::hardware_concurrency());
 
     string query = dataset[rand()%dataset.size()];
     string prefix = query.substr(0,3);
 
-    vector<string> autoList;
+    vector<string> autoList, daList;
     autoComplete(rootTrie,prefix,autoList);
+    autoComplete(daTrie,prefix,daList);
 
     string text = randomRecord();
     string pat = "traffic";
@@ -187,9 +1409,15 @@ int main(){
     for(auto &s:sorted2) cout<<s<<"\n";
     cout<<"--\n";
 
+    for(auto &s:sorted3) cout<<s<<"\n";
+    cout<<"--\n";
+
     for(auto &s:autoList) cout<<s<<"\n";
     cout<<"--\n";
 
+    for(auto &s:daList) cout<<s<<"\n";
+    cout<<"--\n";
+
     for(int x:km) cout<<x<<" ";
     cout<<"\n";
 